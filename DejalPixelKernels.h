@@ -0,0 +1,57 @@
+//
+//  DejalPixelKernels.h
+//  Dejal Open Source Categories
+//
+//  Created by David Sinclair on Sat Oct 17 2026.
+//  Copyright (c) 2026 Dejal Systems, LLC. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification,
+//  are permitted provided that the following conditions are met:
+//
+//  - Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+//  - Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+//  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+//  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+//  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+//  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+#ifndef DejalPixelKernels_h
+#define DejalPixelKernels_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// Pixel kernels for premultiplied 8-bit RGBA buffers, with scalar reference versions:
+
+void DejalTintSourceAtopRGBA(uint8_t *pixels, size_t bytesPerRow, size_t width, size_t height, const uint8_t tint[4]);
+void DejalTintSourceAtopRGBAScalar(uint8_t *pixels, size_t bytesPerRow, size_t width, size_t height, const uint8_t tint[4]);
+
+void DejalCompositeSourceOverRGBA(const uint8_t *source, size_t sourceBytesPerRow, uint8_t *destination, size_t destinationBytesPerRow, size_t width, size_t height, uint8_t alpha);
+void DejalCompositeSourceOverRGBAScalar(const uint8_t *source, size_t sourceBytesPerRow, uint8_t *destination, size_t destinationBytesPerRow, size_t width, size_t height, uint8_t alpha);
+
+void DejalCopyFlippedRGBA(const uint8_t *source, size_t sourceBytesPerRow, uint8_t *destination, size_t destinationBytesPerRow, size_t width, size_t height);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -32,6 +32,9 @@
 
 @property (nonatomic, strong, setter=dejal_setTextColor:) NSColor *dejal_textColor;
 
++ (void)dejal_restyleButtonsInView:(NSView *)view usingBlock:(void (^)(NSButton *button))block;
++ (void)dejal_setTextColor:(NSColor *)textColor ofButtonsInView:(NSView *)view;
+
 - (void)dejal_displayMenu:(NSMenu *)menu;
 - (void)dejal_displayMenu:(NSMenu *)menu withOffset:(CGFloat)verticalOffset;
 - (void)dejal_displayMenu:(NSMenu *)menu withHorizontalOffset:(CGFloat)horizontalOffset verticalOffset:(CGFloat)verticalOffset;
@@ -43,6 +46,10 @@
 
 @property (nonatomic, setter=dejal_setRadiosEnabled:) BOOL dejal_radiosEnabled;
 
+- (NSArray *)dejal_radios;
+- (NSButton *)dejal_selectedRadio;
+- (void)dejal_invalidateRadioGroup;
+
 - (void)dejal_selectRadioWithTag:(NSInteger)tag;
 - (NSInteger)dejal_selectedRadioTag;
 
@@ -28,18 +28,70 @@
 //
 
 #import "NSButton+Dejal.h"
+#import <objc/runtime.h>
+#import <QuartzCore/QuartzCore.h>
+
+
+/**
+ Private record of the text color last applied to a button via -dejal_setTextColor:, and the resulting attributed title, so redundant sets can be skipped.
+ 
+ @author DJS 2026-10.
+ */
+
+@interface DejalButtonTextColor : NSObject
+
+@property (nonatomic, strong) NSColor *textColor;
+@property (nonatomic, copy) NSAttributedString *attributedTitle;
+
+@end
+
+
+@implementation DejalButtonTextColor
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
 
 
 @implementation NSButton (Dejal)
 
+/**
+ Returns the record of the text color applied via -dejal_setTextColor:, if it is still current, i.e. the attributed title (including its attributes, e.g. a color set some other way) hasn't changed since.
+ 
+ @author DJS 2026-10.
+ */
+
+- (DejalButtonTextColor *)dejal_appliedTextColor;
+{
+    DejalButtonTextColor *applied = objc_getAssociatedObject(self, @selector(dejal_appliedTextColor));
+    
+    if (applied && ![applied.attributedTitle isEqualToAttributedString:self.attributedTitle])
+    {
+        return nil;
+    }
+    
+    return applied;
+}
+
 /**
  Returns the color of the receiver's text.
  
  @author DJS 2014-10, based on Apple's Popover sample code.
+ @version DJS 2026-10: Changed to return the color applied via -dejal_setTextColor:, if the attributed title hasn't changed since, instead of reading the title attributes.
  */
 
 - (NSColor *)dejal_textColor;
 {
+    DejalButtonTextColor *applied = [self dejal_appliedTextColor];
+    
+    if (applied)
+    {
+        return applied.textColor;
+    }
+    
     NSAttributedString *attrTitle = self.attributedTitle;
     NSColor *textColor = [NSColor controlTextColor];
     
@@ -57,13 +109,21 @@
 }
 
 /**
- Sets the receiver's text to the specified color.
+ Sets the receiver's text to the specified color.  The color is remembered with the resulting attributed title, so setting the same color again does nothing, unless the title or its attributes have changed.
  
  @author DJS 2014-10, based on Apple's Popover sample code.
+ @version DJS 2026-10: Changed to skip redundant sets.
  */
 
 - (void)dejal_setTextColor:(NSColor *)textColor;
 {
+    DejalButtonTextColor *applied = [self dejal_appliedTextColor];
+    
+    if (applied && (applied.textColor == textColor || [applied.textColor isEqual:textColor]))
+    {
+        return;
+    }
+    
     NSMutableAttributedString *attrTitle = [[NSMutableAttributedString alloc] initWithAttributedString:self.attributedTitle];
     NSRange range = NSMakeRange(0, attrTitle.length);
     
@@ -79,6 +139,68 @@
     [attrTitle fixAttributesInRange:range];
     
     self.attributedTitle = attrTitle;
+    
+    applied = [DejalButtonTextColor new];
+    applied.textColor = textColor;
+    applied.attributedTitle = self.attributedTitle;
+    
+    objc_setAssociatedObject(self, @selector(dejal_appliedTextColor), applied, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+/**
+ Invokes the block for each button in the view's subtree (including the view itself, if it's a button).  The subtree is walked without recursion.  Implicit animations are disabled for layer-backed buttons; otherwise AppKit just marks the changed buttons as needing display, and draws them in its usual display pass at the end of the run loop pass.  Intended for restyling many buttons at once, e.g. on an appearance change.
+ 
+ @param view The root of the subtree.
+ @param block A block that takes a button as a parameter, e.g. to set its text color.
+ 
+ @author DJS 2026-10.
+ */
+
++ (void)dejal_restyleButtonsInView:(NSView *)view usingBlock:(void (^)(NSButton *button))block;
+{
+    if (!view || !block)
+    {
+        return;
+    }
+    
+    NSMutableArray *stack = [NSMutableArray arrayWithObject:view];
+    
+    // This only affects layer-backed buttons:
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    
+    while (stack.count)
+    {
+        NSView *currentView = stack.lastObject;
+        
+        [stack removeLastObject];
+        
+        if ([currentView isKindOfClass:[NSButton class]])
+        {
+            block((NSButton *)currentView);
+        }
+        
+        [stack addObjectsFromArray:currentView.subviews];
+    }
+    
+    [CATransaction commit];
+}
+
+/**
+ Sets the text color of every button in the view's subtree; buttons that already have that color are skipped.  See +dejal_restyleButtonsInView:usingBlock:.
+ 
+ @param textColor The color to apply, or nil to remove the color.
+ @param view The root of the subtree.
+ 
+ @author DJS 2026-10.
+ */
+
++ (void)dejal_setTextColor:(NSColor *)textColor ofButtonsInView:(NSView *)view;
+{
+    [self dejal_restyleButtonsInView:view usingBlock:^(NSButton *button)
+     {
+         button.dejal_textColor = textColor;
+     }];
 }
 
 /**
@@ -151,22 +273,234 @@
 // ----------------------------------------------------------------------------------------
 
 
+/**
+ Private cached radio group: the buttons in a superview with the same action, in subview order, and the last known selected radio.  Built lazily and validated cheaply on each use; see -[NSButton dejal_radioGroup].
+ 
+ @author DJS 2026-10.
+ */
+
+@interface DejalRadioGroup : NSObject
+
+@property (nonatomic, weak) NSView *superview;
+@property (nonatomic) SEL action;
+@property (nonatomic, strong) NSArray *radios;
+@property (nonatomic, weak) NSButton *selectedRadio;
+
+- (instancetype)initWithSuperview:(NSView *)superview action:(SEL)action;
+- (BOOL)isValid;
+- (NSButton *)findSelectedRadio;
+
+@end
+
+
+@implementation DejalRadioGroup
+
+/**
+ Scans the superview once to build the group.
+ */
+
+- (instancetype)initWithSuperview:(NSView *)superview action:(SEL)action;
+{
+    if ((self = [super init]))
+    {
+        NSArray *subviews = superview.subviews;
+        NSMutableArray *radios = [NSMutableArray array];
+        
+        for (NSButton *radio in subviews)
+        {
+            // There's no reliable way to determine if a button is actually a radio button, but it's reasonable to assume that no non-radio will have the same action (and having the same action is what makes it a member of the group):
+            if ([radio isKindOfClass:[NSButton class]] && radio.action == action)
+            {
+                [radios addObject:radio];
+            }
+        }
+        
+        _superview = superview;
+        _action = action;
+        _radios = radios;
+        _selectedRadio = [self findSelectedRadio];
+    }
+    
+    return self;
+}
+
+/**
+ Returns YES if each member is still in the superview with the same action.  Doesn't look at the superview's other subviews (which would copy the subviews array), so added radios aren't noticed; see -[NSButton dejal_invalidateRadioGroup].
+ */
+
+- (BOOL)isValid;
+{
+    NSView *superview = self.superview;
+    
+    if (!superview)
+    {
+        return NO;
+    }
+    
+    for (NSButton *radio in self.radios)
+    {
+        if (radio.superview != superview || radio.action != self.action)
+        {
+            return NO;
+        }
+    }
+    
+    return YES;
+}
+
+/**
+ Scans the group for the first radio that is on.
+ */
+
+- (NSButton *)findSelectedRadio;
+{
+    for (NSButton *radio in self.radios)
+    {
+        if (radio.state == NSOnState)
+        {
+            return radio;
+        }
+    }
+    
+    return nil;
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
+
+
 @implementation NSButton (DejalRadios)
 
+/**
+ Returns the receiver's cached radio group, if any, without validating it.
+ 
+ @author DJS 2026-10.
+ */
+
+- (DejalRadioGroup *)dejal_cachedRadioGroup;
+{
+    NSMutableDictionary *groups = self.superview ? objc_getAssociatedObject(self.superview, @selector(dejal_radioGroup)) : nil;
+    
+    return groups[[NSValue valueWithPointer:self.action]];
+}
+
+/**
+ Returns the receiver's radio group (i.e. the buttons in the same superview with the same action).  Groups are cached per superview and action, and rebuilt when a member moves or changes action.  Call -dejal_invalidateRadioGroup after other changes that affect membership, e.g. adding a radio to the superview, or replacing one.
+ 
+ @author DJS 2026-10.
+ */
+
+- (DejalRadioGroup *)dejal_radioGroup;
+{
+    NSView *superview = self.superview;
+    
+    if (!superview)
+    {
+        return nil;
+    }
+    
+    NSMutableDictionary *groups = objc_getAssociatedObject(superview, @selector(dejal_radioGroup));
+    NSValue *key = [NSValue valueWithPointer:self.action];
+    
+    if (!groups)
+    {
+        groups = [NSMutableDictionary dictionary];
+        objc_setAssociatedObject(superview, @selector(dejal_radioGroup), groups, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    
+    DejalRadioGroup *group = groups[key];
+    
+    if (!group || ![group isValid])
+    {
+        group = [[DejalRadioGroup alloc] initWithSuperview:superview action:self.action];
+        groups[key] = group;
+    }
+    
+    return group;
+}
+
+/**
+ Discards the cached radio groups of the receiver's superview, so they'll be rebuilt on next use.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)dejal_invalidateRadioGroup;
+{
+    if (self.superview)
+    {
+        objc_setAssociatedObject(self.superview, @selector(dejal_radioGroup), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+}
+
+/**
+ Assuming the receiver is a radio button, returns the radio buttons in the group (i.e. in the same superview and with the same action), in subview order.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSArray *)dejal_radios;
+{
+    return [self dejal_radioGroup].radios ?: @[];
+}
+
+/**
+ Assuming the receiver is a radio button, returns the selected radio in the group, or nil if none.  The last known selection is checked first, and returned without validating or scanning the group if it is still on and in the same superview with the same action, so this is O(1) unless the selection has changed, e.g. via a click.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSButton *)dejal_selectedRadio;
+{
+    NSButton *selectedRadio = [self dejal_cachedRadioGroup].selectedRadio;
+    
+    if (selectedRadio.state == NSOnState && selectedRadio.superview == self.superview && selectedRadio.action == self.action)
+    {
+        return selectedRadio;
+    }
+    
+    DejalRadioGroup *group = [self dejal_radioGroup];
+    
+    selectedRadio = group.selectedRadio;
+    
+    if (selectedRadio.state != NSOnState)
+    {
+        selectedRadio = [group findSelectedRadio];
+        group.selectedRadio = selectedRadio;
+    }
+    
+    return selectedRadio;
+}
+
 /**
  Assuming the receiver is a radio button, finds other radio buttons in the group (i.e. in the same superview and with the same action) and selects the one with the specified tag.  Invoke this on any of the radios in the group.  A replacement for -[NSMatrix selectCellWithTag:].
  
  @param tag The tag value to select.
  
  @author DJS 2015-01.
+ @version DJS 2026-10: Changed to use the cached radio group, instead of searching the superview.
  */
 
 - (void)dejal_selectRadioWithTag:(NSInteger)tag;
 {
-    [self dejal_enumerateRadiosUsingBlock:^(NSButton *radio, BOOL *stop)
-     {
-         radio.state = radio.tag == tag;
-     }];
+    DejalRadioGroup *group = [self dejal_radioGroup];
+    NSButton *selectedRadio = nil;
+    
+    for (NSButton *radio in group.radios)
+    {
+        radio.state = radio.tag == tag;
+        
+        if (radio.tag == tag && !selectedRadio)
+        {
+            selectedRadio = radio;
+        }
+    }
+    
+    group.selectedRadio = selectedRadio;
 }
 
 /**
@@ -175,16 +509,12 @@
  @returns A tag value integer.
  
  @author DJS 2015-01.
+ @version DJS 2026-10: Changed to use the cached selected radio.
  */
 
 - (NSInteger)dejal_selectedRadioTag;
 {
-    NSButton *foundRadio = [self dejal_radioPassingTest:^BOOL(NSButton *radio, BOOL *stop)
-     {
-         return radio.state;
-     }];
-    
-    return foundRadio.tag;
+    return [self dejal_selectedRadio].tag;
 }
 
 /**
@@ -219,26 +549,28 @@
  @returns The found radio button, or nil if none is found.
  
  @author DJS 2015-01.
+ @version DJS 2026-10: Changed to use the cached radio group.
  */
 
 - (NSButton *)dejal_radioPassingTest:(BOOL (^)(NSButton *radio, BOOL *stop))predicate;
 {
-    for (NSButton *radio in self.superview.subviews)
+    if (!predicate)
     {
-        // There's no reliable way to determine if a button is actually a radio button, but it's reasonable to assume that no non-radio will have the same action (and having the same action is what makes it a member of the group):
-        if ([radio isKindOfClass:[NSButton class]] && radio.action == self.action && predicate)
+        return nil;
+    }
+    
+    for (NSButton *radio in [self dejal_radios])
+    {
+        BOOL stop = NO;
+        
+        if (predicate(radio, &stop))
         {
-            BOOL stop = NO;
-            
-            if (predicate(radio, &stop))
-            {
-                return radio;
-            }
-            
-            if (stop)
-            {
-                return nil;
-            }
+            return radio;
+        }
+        
+        if (stop)
+        {
+            return nil;
         }
     }
     
@@ -251,23 +583,25 @@
  @param block A block that takes a radio button and stop boolean reference as parameters and returns void.
  
  @author DJS 2015-01.
+ @version DJS 2026-10: Changed to use the cached radio group.
  */
 
 - (void)dejal_enumerateRadiosUsingBlock:(void (^)(NSButton *radio, BOOL *stop))block;
 {
-    for (NSButton *radio in self.superview.subviews)
+    if (!block)
     {
-        // There's no reliable way to determine if a button is actually a radio button, but it's reasonable to assume that no non-radio will have the same action (and having the same action is what makes it a member of the group):
-        if ([radio isKindOfClass:[NSButton class]] && radio.action == self.action && block)
+        return;
+    }
+    
+    for (NSButton *radio in [self dejal_radios])
+    {
+        BOOL stop = NO;
+        
+        block(radio, &stop);
+        
+        if (stop)
         {
-            BOOL stop = NO;
-            
-            block(radio, &stop);
-            
-            if (stop)
-            {
-                return;
-            }
+            return;
         }
     }
 }
@@ -28,6 +28,14 @@
 //
 
 
+typedef NS_ENUM(NSInteger, DejalPNGCompression)
+{
+    DejalPNGCompressionDefault = 0,
+    DejalPNGCompressionFast,
+    DejalPNGCompressionSmall
+};
+
+
 @interface NSImage (Dejal)
 
 - (void)dejal_drawFlippedInRect:(NSRect)rect operation:(NSCompositingOperation)op fraction:(CGFloat)delta;
@@ -39,7 +47,34 @@
 - (NSImage *)dejal_tintedImageWithColor:(NSColor *)tint;
 - (NSImage *)dejal_tintedImageWithColor:(NSColor *)tint operation:(NSCompositingOperation)operation;
 
+- (NSImage *)dejal_imageRenderedAtBackingScaleFactor:(CGFloat)backingScaleFactor usingBlock:(void (^)(NSRect bounds))block;
+
++ (NSImage *)dejal_imageWithSize:(NSSize)size backingScaleFactor:(CGFloat)backingScaleFactor usingBlock:(void (^)(NSRect bounds))block;
+- (NSImage *)dejal_resizedImageWithSize:(NSSize)size backingScaleFactor:(CGFloat)backingScaleFactor;
+
+- (NSBitmapImageRep *)dejal_RGBABitmapAtBackingScaleFactor:(CGFloat)backingScaleFactor;
+- (NSImage *)dejal_bitmapTintedImageWithColor:(NSColor *)tint backingScaleFactor:(CGFloat)backingScaleFactor;
+- (NSImage *)dejal_bitmapImageWithBadge:(NSImage *)badge alpha:(CGFloat)alpha scale:(CGFloat)scale backingScaleFactor:(CGFloat)backingScaleFactor;
+- (NSImage *)dejal_bitmapFlippedImageAtBackingScaleFactor:(CGFloat)backingScaleFactor;
+
+- (NSImage *)dejal_cachedTintedImageWithColor:(NSColor *)tint operation:(NSCompositingOperation)operation backingScaleFactor:(CGFloat)backingScaleFactor;
+- (NSImage *)dejal_cachedImageWithBadge:(NSImage *)badge alpha:(CGFloat)alpha scale:(CGFloat)scale backingScaleFactor:(CGFloat)backingScaleFactor;
+
++ (void)dejal_setImageCacheCountLimit:(NSUInteger)countLimit;
++ (void)dejal_removeAllCachedImages;
++ (NSUInteger)dejal_imageCacheHits;
++ (NSUInteger)dejal_imageCacheMisses;
+
 - (NSData *)dejal_PNGRepresentation;
+- (NSData *)dejal_PNGRepresentationWithCompression:(DejalPNGCompression)compression;
+- (BOOL)dejal_writePNGToURL:(NSURL *)url compression:(DejalPNGCompression)compression;
+- (BOOL)dejal_writePNGToStream:(NSOutputStream *)stream compression:(DejalPNGCompression)compression;
+
++ (NSArray *)dejal_PNGRepresentationsOfImages:(NSArray *)images compression:(DejalPNGCompression)compression;
+
+- (NSImage *)dejal_imageByApplyingOperation:(NSDictionary *)operationInfo backingScaleFactor:(CGFloat)backingScaleFactor;
+
++ (void)dejal_processImages:(NSArray *)images operations:(NSArray *)operations encodePNG:(BOOL)encodePNG compression:(DejalPNGCompression)compression backingScaleFactor:(CGFloat)backingScaleFactor maxInFlight:(NSUInteger)maxInFlight resultHandler:(void (^)(NSUInteger index, NSImage *image, NSData *pngData))resultHandler completionHandler:(void (^)(NSTimeInterval elapsedTime))completion;
 
 @end
 
@@ -28,6 +28,61 @@
 //
 
 #import "NSImage+Dejal.h"
+#import "DejalPixelKernels.h"
+#import <ImageIO/ImageIO.h>
+
+
+/**
+ Private key for the shared cache of derived images.  The source and badge images are compared by identity, and held weakly, so an entry can't be matched by a different image that happens to reuse a deallocated image's address.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalImageCacheKey : NSObject <NSCopying>
+
+@property (nonatomic, weak) NSImage *source;
+@property (nonatomic, weak) NSImage *badge;
+@property (nonatomic) NSUInteger sourceAddress;
+@property (nonatomic) NSUInteger badgeAddress;
+@property (nonatomic, strong) NSColor *color;
+@property (nonatomic) NSCompositingOperation operation;
+@property (nonatomic) CGFloat alpha;
+@property (nonatomic) CGFloat scale;
+@property (nonatomic) CGFloat backingScaleFactor;
+
+@end
+
+
+@implementation DejalImageCacheKey
+
+- (id)copyWithZone:(NSZone *)zone;
+{
+    // Keys are never changed after being created, so can be shared:
+    return self;
+}
+
+- (NSUInteger)hash;
+{
+    return self.sourceAddress ^ (self.badgeAddress << 1) ^ self.color.hash ^ ((NSUInteger)self.operation << 8) ^ (NSUInteger)(self.alpha * 1000.0) ^ ((NSUInteger)(self.scale * 1000.0) << 12) ^ ((NSUInteger)self.backingScaleFactor << 24);
+}
+
+- (BOOL)isEqual:(id)object;
+{
+    if (![object isKindOfClass:[DejalImageCacheKey class]])
+        return NO;
+    
+    DejalImageCacheKey *other = object;
+    NSImage *source = self.source;
+    
+    return source && source == other.source && self.badge == other.badge && self.badgeAddress == other.badgeAddress && self.operation == other.operation && self.alpha == other.alpha && self.scale == other.scale && self.backingScaleFactor == other.backingScaleFactor && (self.color == other.color || [self.color isEqual:other.color]);
+}
+
+@end
+
+
+static NSCache *DejalImageCache = nil;
+static NSUInteger DejalImageCacheHits = 0;
+static NSUInteger DejalImageCacheMisses = 0;
 
 
 @implementation NSImage (Dejal)
@@ -94,21 +149,631 @@
     return image;
 }
 
+/**
+ Returns the shared cache of derived images, which is bounded by a count limit and automatically evicts entries under memory pressure.
+ 
+ @author DJS 2026-10.
+*/
+
++ (NSCache *)dejal_imageCache;
+{
+    static dispatch_once_t onceToken;
+    
+    dispatch_once(&onceToken, ^
+                  {
+                      DejalImageCache = [NSCache new];
+                      DejalImageCache.name = @"com.dejal.image-cache";
+                      DejalImageCache.countLimit = 500;
+                  });
+    
+    return DejalImageCache;
+}
+
+/**
+ Sets the maximum number of derived images to keep in the cache; defaults to 500.
+ 
+ @author DJS 2026-10.
+*/
+
++ (void)dejal_setImageCacheCountLimit:(NSUInteger)countLimit;
+{
+    [self dejal_imageCache].countLimit = countLimit;
+}
+
+/**
+ Discards all cached derived images, and resets the hit and miss counters.
+ 
+ @author DJS 2026-10.
+*/
+
++ (void)dejal_removeAllCachedImages;
+{
+    [[self dejal_imageCache] removeAllObjects];
+    
+    @synchronized ([self dejal_imageCache])
+    {
+        DejalImageCacheHits = 0;
+        DejalImageCacheMisses = 0;
+    }
+}
+
+/**
+ Returns the number of requests for derived images that were satisfied from the cache.
+ 
+ @author DJS 2026-10.
+*/
+
++ (NSUInteger)dejal_imageCacheHits;
+{
+    @synchronized ([self dejal_imageCache])
+    {
+        return DejalImageCacheHits;
+    }
+}
+
+/**
+ Returns the number of requests for derived images that had to be rendered.
+ 
+ @author DJS 2026-10.
+*/
+
++ (NSUInteger)dejal_imageCacheMisses;
+{
+    @synchronized ([self dejal_imageCache])
+    {
+        return DejalImageCacheMisses;
+    }
+}
+
+/**
+ Returns a new image the same size as the receiver, rendered into a bitmap at the backing scale factor (e.g. 2.0 for Retina) via the drawing block, without using -lockFocus, so it is safe to call from any thread.  The block is invoked with the image bounds, in points, and a graphics context set as current.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_imageRenderedAtBackingScaleFactor:(CGFloat)backingScaleFactor usingBlock:(void (^)(NSRect bounds))block;
+{
+    return [NSImage dejal_imageWithSize:self.size backingScaleFactor:backingScaleFactor usingBlock:block];
+}
+
+/**
+ Returns a new image of the specified size, rendered into a bitmap at the backing scale factor via the drawing block, without using -lockFocus, so it is safe to call from any thread.  The block is invoked with the image bounds, in points, and a graphics context set as current.
+ 
+ @author DJS 2026-10.
+*/
+
++ (NSImage *)dejal_imageWithSize:(NSSize)size backingScaleFactor:(CGFloat)backingScaleFactor usingBlock:(void (^)(NSRect bounds))block;
+{
+    if (backingScaleFactor <= 0.0)
+        backingScaleFactor = 1.0;
+    
+    NSBitmapImageRep *rep = [[NSBitmapImageRep alloc] initWithBitmapDataPlanes:NULL pixelsWide:(NSInteger)ceil(size.width * backingScaleFactor) pixelsHigh:(NSInteger)ceil(size.height * backingScaleFactor) bitsPerSample:8 samplesPerPixel:4 hasAlpha:YES isPlanar:NO colorSpaceName:NSCalibratedRGBColorSpace bytesPerRow:0 bitsPerPixel:0];
+    
+    if (!rep)
+        return nil;
+    
+    rep.size = size;
+    
+    NSGraphicsContext *context = [NSGraphicsContext graphicsContextWithBitmapImageRep:rep];
+    
+    [NSGraphicsContext saveGraphicsState];
+    [NSGraphicsContext setCurrentContext:context];
+    
+    block(NSMakeRect(0.0, 0.0, size.width, size.height));
+    
+    [context flushGraphics];
+    [NSGraphicsContext restoreGraphicsState];
+    
+    NSImage *image = [[NSImage alloc] initWithSize:size];
+    
+    [image addRepresentation:rep];
+    
+    return image;
+}
+
+/**
+ Returns the cached image for the key, or renders it via the block and caches it, updating the hit and miss counters.
+ 
+ @author DJS 2026-10.
+*/
+
++ (NSImage *)dejal_cachedImageForKey:(DejalImageCacheKey *)key render:(NSImage * (^)(void))render;
+{
+    NSCache *cache = [self dejal_imageCache];
+    NSImage *image = [cache objectForKey:key];
+    
+    @synchronized (cache)
+    {
+        if (image)
+            DejalImageCacheHits++;
+        else
+            DejalImageCacheMisses++;
+    }
+    
+    if (!image)
+    {
+        image = render();
+        
+        if (image)
+            [cache setObject:image forKey:key];
+    }
+    
+    return image;
+}
+
+/**
+ Like -dejal_tintedImageWithColor:operation:, but returns a shared cached image if the same tint has already been applied to the receiver at the same backing scale factor, otherwise renders and caches it.  The result is rendered into a bitmap at the backing scale factor (pass e.g. the window's backingScaleFactor), so doesn't need to be re-rasterized when drawn.  The returned image is shared, so must not be modified.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_cachedTintedImageWithColor:(NSColor *)tint operation:(NSCompositingOperation)operation backingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    DejalImageCacheKey *key = [DejalImageCacheKey new];
+    
+    key.source = self;
+    key.sourceAddress = (NSUInteger)(__bridge void *)self;
+    key.color = tint;
+    key.operation = operation;
+    key.alpha = 1.0;
+    key.scale = 1.0;
+    key.backingScaleFactor = backingScaleFactor;
+    
+    return [NSImage dejal_cachedImageForKey:key render:^NSImage *
+            {
+                return [self dejal_imageRenderedAtBackingScaleFactor:backingScaleFactor usingBlock:^(NSRect bounds)
+                        {
+                            [self drawInRect:bounds fromRect:NSZeroRect operation:NSCompositingOperationSourceOver fraction:1.0];
+                            [tint set];
+                            NSRectFillUsingOperation(bounds, operation);
+                        }];
+            }];
+}
+
+/**
+ Returns a new image with the badge applied as for -dejal_applyBadge:withAlpha:scale:, but without modifying the receiver, and returning a shared cached image if the same badge has already been applied to the receiver with the same settings, otherwise renders and caches it.  The returned image is shared, so must not be modified.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_cachedImageWithBadge:(NSImage *)badge alpha:(CGFloat)alpha scale:(CGFloat)scale backingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    if (!badge)
+        return self;
+    
+    DejalImageCacheKey *key = [DejalImageCacheKey new];
+    
+    key.source = self;
+    key.sourceAddress = (NSUInteger)(__bridge void *)self;
+    key.badge = badge;
+    key.badgeAddress = (NSUInteger)(__bridge void *)badge;
+    key.operation = NSCompositingOperationSourceOver;
+    key.alpha = alpha;
+    key.scale = scale;
+    key.backingScaleFactor = backingScaleFactor;
+    
+    return [NSImage dejal_cachedImageForKey:key render:^NSImage *
+            {
+                return [self dejal_imageRenderedAtBackingScaleFactor:backingScaleFactor usingBlock:^(NSRect bounds)
+                        {
+                            NSSize badgeSize = NSMakeSize(bounds.size.width * scale, bounds.size.height * scale);
+                            
+                            [[NSGraphicsContext currentContext] setImageInterpolation:NSImageInterpolationHigh];
+                            [self drawInRect:bounds fromRect:NSZeroRect operation:NSCompositingOperationSourceOver fraction:1.0];
+                            [badge drawInRect:NSMakeRect(bounds.size.width - badgeSize.width, 0.0, badgeSize.width, badgeSize.height) fromRect:NSZeroRect operation:NSCompositingOperationSourceOver fraction:alpha];
+                        }];
+            }];
+}
+
+/**
+ Returns a new bitmap of the receiver as premultiplied 8-bit RGBA pixels, at the backing scale factor, suitable for use with the pixel kernels.  Safe to call from any thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSBitmapImageRep *)dejal_RGBABitmapAtBackingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    NSImage *image = [self dejal_imageRenderedAtBackingScaleFactor:backingScaleFactor usingBlock:^(NSRect bounds)
+                      {
+                          [self drawInRect:bounds fromRect:NSZeroRect operation:NSCompositingOperationCopy fraction:1.0];
+                      }];
+    
+    return (NSBitmapImageRep *)image.representations.firstObject;
+}
+
+/**
+ Like -dejal_tintedImageWithColor:, i.e. using the source-atop operation, but tints the pixels directly in a bitmap via a vectorized kernel instead of drawing via -lockFocus, so it is safe to call from any thread, e.g. to tint many icons concurrently.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_bitmapTintedImageWithColor:(NSColor *)tint backingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    NSBitmapImageRep *rep = [self dejal_RGBABitmapAtBackingScaleFactor:backingScaleFactor];
+    NSColor *rgbTint = [tint colorUsingColorSpace:[NSColorSpace genericRGBColorSpace]];
+    
+    if (!rep || !rgbTint)
+        return nil;
+    
+    CGFloat alpha = rgbTint.alphaComponent;
+    uint8_t premultipliedTint[4] = {(uint8_t)lround(rgbTint.redComponent * alpha * 255.0), (uint8_t)lround(rgbTint.greenComponent * alpha * 255.0), (uint8_t)lround(rgbTint.blueComponent * alpha * 255.0), (uint8_t)lround(alpha * 255.0)};
+    
+    DejalTintSourceAtopRGBA(rep.bitmapData, rep.bytesPerRow, rep.pixelsWide, rep.pixelsHigh, premultipliedTint);
+    
+    NSImage *image = [[NSImage alloc] initWithSize:self.size];
+    
+    [image addRepresentation:rep];
+    
+    return image;
+}
+
+/**
+ Like -dejal_applyBadge:withAlpha:scale:, but returns a new image instead of modifying the receiver, compositing the badge pixels directly via a vectorized kernel instead of drawing via -lockFocus, so it is safe to call from any thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_bitmapImageWithBadge:(NSImage *)badge alpha:(CGFloat)alpha scale:(CGFloat)scale backingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    NSBitmapImageRep *rep = [self dejal_RGBABitmapAtBackingScaleFactor:backingScaleFactor];
+    
+    if (!rep || !badge)
+        return nil;
+    
+    NSImage *scaledBadge = [badge copy];
+    
+    scaledBadge.size = NSMakeSize(self.size.width * scale, self.size.height * scale);
+    
+    NSBitmapImageRep *badgeRep = [scaledBadge dejal_RGBABitmapAtBackingScaleFactor:backingScaleFactor];
+    NSInteger width = MIN(badgeRep.pixelsWide, rep.pixelsWide);
+    NSInteger height = MIN(badgeRep.pixelsHigh, rep.pixelsHigh);
+    
+    // The badge goes in the bottom-right corner; bitmap rows start at the top:
+    uint8_t *destination = rep.bitmapData + (rep.pixelsHigh - height) * rep.bytesPerRow + (rep.pixelsWide - width) * 4;
+    
+    DejalCompositeSourceOverRGBA(badgeRep.bitmapData, badgeRep.bytesPerRow, destination, rep.bytesPerRow, width, height, (uint8_t)lround(MAX(MIN(alpha, 1.0), 0.0) * 255.0));
+    
+    NSImage *image = [[NSImage alloc] initWithSize:self.size];
+    
+    [image addRepresentation:rep];
+    
+    return image;
+}
+
+/**
+ Returns a new image that is a vertically flipped copy of the receiver, as drawn by -dejal_drawFlippedInRect:operation:, produced by copying bitmap rows rather than drawing with a flipped transform.  Safe to call from any thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_bitmapFlippedImageAtBackingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    NSBitmapImageRep *rep = [self dejal_RGBABitmapAtBackingScaleFactor:backingScaleFactor];
+    
+    if (!rep)
+        return nil;
+    
+    NSBitmapImageRep *flippedRep = [[NSBitmapImageRep alloc] initWithBitmapDataPlanes:NULL pixelsWide:rep.pixelsWide pixelsHigh:rep.pixelsHigh bitsPerSample:8 samplesPerPixel:4 hasAlpha:YES isPlanar:NO colorSpaceName:NSCalibratedRGBColorSpace bytesPerRow:0 bitsPerPixel:0];
+    
+    flippedRep.size = rep.size;
+    
+    DejalCopyFlippedRGBA(rep.bitmapData, rep.bytesPerRow, flippedRep.bitmapData, flippedRep.bytesPerRow, rep.pixelsWide, rep.pixelsHigh);
+    
+    NSImage *image = [[NSImage alloc] initWithSize:self.size];
+    
+    [image addRepresentation:flippedRep];
+    
+    return image;
+}
+
+/**
+ Returns a CGImage of the receiver for encoding, with the same pixel dimensions as -CGImageForProposedRect:context:hints: gives for the image's own size (so the output is the same as before this was optimized; e.g. a 16 point icon doesn't export at 1024 x 1024).  If a bitmap representation has exactly those dimensions, its pixels are used directly, rather than a rendered copy.
+ 
+ @author DJS 2026-10.
+*/
+
+- (CGImageRef)dejal_CGImageForEncoding;
+{
+    CGImageRef imageRef = [self CGImageForProposedRect:NULL context:nil hints:nil];
+    
+    if (!imageRef)
+        return NULL;
+    
+    NSInteger pixelsWide = CGImageGetWidth(imageRef);
+    NSInteger pixelsHigh = CGImageGetHeight(imageRef);
+    
+    for (NSImageRep *rep in self.representations)
+    {
+        if ([rep isKindOfClass:[NSBitmapImageRep class]] && rep.pixelsWide == pixelsWide && rep.pixelsHigh == pixelsHigh && [(NSBitmapImageRep *)rep CGImage])
+            return [(NSBitmapImageRep *)rep CGImage];
+    }
+    
+    return imageRef;
+}
+
+/**
+ Adds the receiver to the image destination as a PNG with the compression preference, setting the resolution so the image keeps its point size (as setting the size of a bitmap rep would), and finalizes the destination.  Returns YES if successful.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_writePNGToImageDestination:(CGImageDestinationRef)destination compression:(DejalPNGCompression)compression;
+{
+    CGImageRef imageRef = [self dejal_CGImageForEncoding];
+    
+    if (!destination || !imageRef)
+        return NO;
+    
+    NSSize size = self.size;
+    CGFloat dpi = size.width > 0.0 ? 72.0 * CGImageGetWidth(imageRef) / size.width : 72.0;
+    NSMutableDictionary *pngProperties = [NSMutableDictionary dictionary];
+    
+    // No filtering is the fastest to encode; adaptive filtering (trying every filter per row) gives the smallest output.  The filter key is only available on OS X 10.11 or later; earlier versions use the default:
+    if (&kCGImagePropertyPNGCompressionFilter != NULL)
+    {
+        if (compression == DejalPNGCompressionFast)
+            pngProperties[(__bridge NSString *)kCGImagePropertyPNGCompressionFilter] = @(IMAGEIO_PNG_NO_FILTERS);
+        else if (compression == DejalPNGCompressionSmall)
+            pngProperties[(__bridge NSString *)kCGImagePropertyPNGCompressionFilter] = @(IMAGEIO_PNG_ALL_FILTERS);
+    }
+    
+    NSDictionary *properties = @{(__bridge NSString *)kCGImagePropertyDPIWidth : @(dpi),
+                                 (__bridge NSString *)kCGImagePropertyDPIHeight : @(dpi),
+                                 (__bridge NSString *)kCGImagePropertyPNGDictionary : pngProperties};
+    
+    CGImageDestinationAddImage(destination, imageRef, (__bridge CFDictionaryRef)properties);
+    
+    return CGImageDestinationFinalize(destination);
+}
+
 /**
  Returns a PNG representation of the receiver.
  
  @author DJS 2014-10.
  @version DJS 2015-09: Changed to use an empty dictionary instead of nil, to avoid a nullability warning.
+ @version DJS 2026-10: Changed to encode a bitmap representation with the same pixel dimensions directly, if there is one.
  */
 
 - (NSData *)dejal_PNGRepresentation;
 {
-    CGImageRef cgRef = [self CGImageForProposedRect:NULL context:nil hints:nil];
-    NSBitmapImageRep *newRep = [[NSBitmapImageRep alloc] initWithCGImage:cgRef];
+    return [self dejal_PNGRepresentationWithCompression:DejalPNGCompressionDefault];
+}
+
+/**
+ Returns a PNG representation of the receiver, encoded with the compression preference: DejalPNGCompressionFast to favor encoding speed, DejalPNGCompressionSmall to favor output size, or DejalPNGCompressionDefault for the system's usual balance (the preference is ignored before OS X 10.11).  The pixel dimensions are the same as -dejal_PNGRepresentation always produced; if a bitmap representation matches them, it is encoded directly.  Safe to call from any thread.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSData *)dejal_PNGRepresentationWithCompression:(DejalPNGCompression)compression;
+{
+    NSMutableData *data = [NSMutableData data];
+    CGImageDestinationRef destination = CGImageDestinationCreateWithData((__bridge CFMutableDataRef)data, CFSTR("public.png"), 1, NULL);
+    BOOL success = [self dejal_writePNGToImageDestination:destination compression:compression];
+    
+    if (destination)
+        CFRelease(destination);
+    
+    return success ? data : nil;
+}
+
+/**
+ Writes a PNG representation of the receiver directly to the file URL, without building the data in memory first.  See -dejal_PNGRepresentationWithCompression: for the compression preference.  Returns YES if successful.
+ 
+ @author DJS 2026-10.
+ */
+
+- (BOOL)dejal_writePNGToURL:(NSURL *)url compression:(DejalPNGCompression)compression;
+{
+    CGImageDestinationRef destination = CGImageDestinationCreateWithURL((__bridge CFURLRef)url, CFSTR("public.png"), 1, NULL);
+    BOOL success = [self dejal_writePNGToImageDestination:destination compression:compression];
+    
+    if (destination)
+        CFRelease(destination);
+    
+    return success;
+}
+
+static size_t DejalOutputStreamPutBytes(void *info, const void *buffer, size_t count)
+{
+    NSOutputStream *stream = (__bridge NSOutputStream *)info;
+    size_t written = 0;
+    
+    while (written < count)
+    {
+        NSInteger result = [stream write:(const uint8_t *)buffer + written maxLength:count - written];
+        
+        if (result <= 0)
+            break;
+        
+        written += result;
+    }
+    
+    return written;
+}
+
+/**
+ Writes a PNG representation of the receiver to the output stream as it is encoded, without building the data in memory first.  The stream should already be open; it is left open.  See -dejal_PNGRepresentationWithCompression: for the compression preference.  Returns YES if successful.
+ 
+ @author DJS 2026-10.
+ */
+
+- (BOOL)dejal_writePNGToStream:(NSOutputStream *)stream compression:(DejalPNGCompression)compression;
+{
+    CGDataConsumerCallbacks callbacks = {DejalOutputStreamPutBytes, NULL};
+    CGDataConsumerRef consumer = CGDataConsumerCreate((__bridge void *)stream, &callbacks);
+    CGImageDestinationRef destination = consumer ? CGImageDestinationCreateWithDataConsumer(consumer, CFSTR("public.png"), 1, NULL) : NULL;
+    BOOL success = [self dejal_writePNGToImageDestination:destination compression:compression];
+    
+    if (destination)
+        CFRelease(destination);
+    
+    if (consumer)
+        CFRelease(consumer);
+    
+    return success && stream.streamError == nil;
+}
+
+/**
+ Returns PNG representations of the images, encoded concurrently, in the same order as the images.  Any that fail to encode are represented by NSNull.  See -dejal_PNGRepresentationWithCompression: for the compression preference.
+ 
+ @author DJS 2026-10.
+ */
+
++ (NSArray *)dejal_PNGRepresentationsOfImages:(NSArray *)images compression:(DejalPNGCompression)compression;
+{
+    NSMutableArray *results = [NSMutableArray arrayWithCapacity:images.count];
+    
+    for (NSUInteger i = 0; i < images.count; i++)
+        [results addObject:[NSNull null]];
+    
+    dispatch_apply(images.count, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^(size_t i)
+                   {
+                       @autoreleasepool
+                       {
+                           NSData *data = [images[i] dejal_PNGRepresentationWithCompression:compression];
+                           
+                           if (data)
+                           {
+                               @synchronized (results)
+                               {
+                                   results[i] = data;
+                               }
+                           }
+                       }
+                   });
+    
+    return results;
+}
+
+/**
+ Returns a new image of the specified size, with the receiver drawn scaled to fill it, rendered into a bitmap at the backing scale factor.  Safe to call from any thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_resizedImageWithSize:(NSSize)size backingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    return [NSImage dejal_imageWithSize:size backingScaleFactor:backingScaleFactor usingBlock:^(NSRect bounds)
+            {
+                [[NSGraphicsContext currentContext] setImageInterpolation:NSImageInterpolationHigh];
+                [self drawInRect:bounds fromRect:NSZeroRect operation:NSCompositingOperationCopy fraction:1.0];
+            }];
+}
+
+/**
+ Returns a new image with the operation described by the dictionary applied to the receiver, or nil if the operation is unknown or fails.  See +dejal_processImages:operations:encodePNG:compression:backingScaleFactor:maxInFlight:resultHandler:completionHandler: for the dictionary keys.  Safe to call from any thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSImage *)dejal_imageByApplyingOperation:(NSDictionary *)operationInfo backingScaleFactor:(CGFloat)backingScaleFactor;
+{
+    NSString *operation = operationInfo[@"Operation"];
+    
+    if ([operation isEqualToString:@"Tint"])
+        return [self dejal_bitmapTintedImageWithColor:operationInfo[@"Color"] backingScaleFactor:backingScaleFactor];
+    else if ([operation isEqualToString:@"Badge"])
+        return [self dejal_bitmapImageWithBadge:operationInfo[@"Badge"] alpha:operationInfo[@"Alpha"] ? [operationInfo[@"Alpha"] doubleValue] : 1.0 scale:operationInfo[@"Scale"] ? [operationInfo[@"Scale"] doubleValue] : 0.5 backingScaleFactor:backingScaleFactor];
+    else if ([operation isEqualToString:@"Flip"])
+        return [self dejal_bitmapFlippedImageAtBackingScaleFactor:backingScaleFactor];
+    else if ([operation isEqualToString:@"Resize"])
+        return [self dejal_resizedImageWithSize:[operationInfo[@"Size"] sizeValue] backingScaleFactor:backingScaleFactor];
+    else
+        return nil;
+}
+
+/**
+ Processes a batch of images on a pool of background workers, applying a sequence of operations to each, and optionally encoding the results as PNG data.
+ 
+ Each operation is a dictionary with an "Operation" key and parameters, applied in order:
+ 
+ - "Tint": tints with the NSColor "Color" key, as for -dejal_tintedImageWithColor:.
+ - "Badge": applies the NSImage "Badge" key, with optional NSNumber "Alpha" (default 1.0) and "Scale" (default 0.5) keys, as for -dejal_applyBadge:withAlpha:scale:.
+ - "Flip": flips vertically, as for -dejal_drawFlippedInRect:operation:.
+ - "Resize": resizes to the NSValue-wrapped NSSize "Size" key.
+ 
+ The operations use the bitmap-based methods above rather than -lockFocus, so are safe to run concurrently.  At most maxInFlight images (or twice the number of processor cores, if zero is passed) are being processed or waiting to be delivered at any time, bounding the memory used regardless of the number of images.  The result handler is invoked on the main queue for each image, strictly in the order of the input array, with the processed image (or nil if an operation failed) and the PNG data (or nil if not requested or encoding failed).  The completion handler, if any, is then invoked on the main queue with the total elapsed time, for measuring throughput.  Should be called on the main thread, which must not be blocked waiting for the results.
+ 
+ @author DJS 2026-10.
+*/
+
++ (void)dejal_processImages:(NSArray *)images operations:(NSArray *)operations encodePNG:(BOOL)encodePNG compression:(DejalPNGCompression)compression backingScaleFactor:(CGFloat)backingScaleFactor maxInFlight:(NSUInteger)maxInFlight resultHandler:(void (^)(NSUInteger index, NSImage *image, NSData *pngData))resultHandler completionHandler:(void (^)(NSTimeInterval elapsedTime))completion;
+{
+    NSArray *imagesCopy = [images copy];
+    NSArray *operationsCopy = [operations copy];
+    NSUInteger count = imagesCopy.count;
+    NSDate *start = [NSDate date];
+    
+    if (!maxInFlight)
+        maxInFlight = MAX([NSProcessInfo processInfo].activeProcessorCount, 1) * 2;
+    
+    if (!count)
+    {
+        if (completion)
+            dispatch_async(dispatch_get_main_queue(), ^
+                           {
+                               completion(0.0);
+                           });
+        
+        return;
+    }
     
-    newRep.size = self.size;
+    dispatch_semaphore_t slots = dispatch_semaphore_create(maxInFlight);
+    dispatch_queue_t workQueue = dispatch_get_global_queue(QOS_CLASS_UTILITY, 0);
+    NSMutableDictionary *finished = [NSMutableDictionary dictionary];
+    __block NSUInteger nextIndex = 0;
     
-    return [newRep representationUsingType:NSBitmapImageFileTypePNG properties:@{}];
+    // Feed the workers from a background queue, waiting for a free slot before starting each image:
+    dispatch_async(workQueue, ^
+                   {
+                       for (NSUInteger i = 0; i < count; i++)
+                       {
+                           dispatch_semaphore_wait(slots, DISPATCH_TIME_FOREVER);
+                           
+                           dispatch_async(workQueue, ^
+                                          {
+                                              NSImage *image = imagesCopy[i];
+                                              NSData *data = nil;
+                                              
+                                              @autoreleasepool
+                                              {
+                                                  for (NSDictionary *operationInfo in operationsCopy)
+                                                  {
+                                                      image = [image dejal_imageByApplyingOperation:operationInfo backingScaleFactor:backingScaleFactor];
+                                                      
+                                                      if (!image)
+                                                          break;
+                                                  }
+                                                  
+                                                  if (image && encodePNG)
+                                                      data = [image dejal_PNGRepresentationWithCompression:compression];
+                                              }
+                                              
+                                              // Deliver in order; a slot is only freed once its result has been delivered:
+                                              dispatch_async(dispatch_get_main_queue(), ^
+                                                             {
+                                                                 finished[@(i)] = @[image ?: [NSNull null], data ?: [NSNull null]];
+                                                                 
+                                                                 NSArray *result = nil;
+                                                                 
+                                                                 while ((result = finished[@(nextIndex)]))
+                                                                 {
+                                                                     [finished removeObjectForKey:@(nextIndex)];
+                                                                     
+                                                                     if (resultHandler)
+                                                                         resultHandler(nextIndex, result[0] != [NSNull null] ? result[0] : nil, result[1] != [NSNull null] ? result[1] : nil);
+                                                                     
+                                                                     nextIndex++;
+                                                                     dispatch_semaphore_signal(slots);
+                                                                 }
+                                                                 
+                                                                 if (nextIndex == count && completion)
+                                                                     completion(-[start timeIntervalSinceNow]);
+                                                             });
+                                          });
+                       }
+                   });
 }
 
 @end
@@ -32,7 +32,12 @@
 
 @interface NSMenu (Dejal)
 
+@property (nonatomic, setter=dejal_setIndexesItems:) BOOL dejal_indexesItems;
+
+- (void)dejal_invalidateItemIndex;
+
 - (void)dejal_addSeparatorItem;
+- (void)dejal_addItem:(NSMenuItem *)item;
 
 - (NSMenuItem *)dejal_addItemWithTitle:(NSString *)aString target:(id)target action:(SEL)aSelector keyEquivalent:(NSString *)keyEquiv;
 
@@ -46,11 +51,16 @@
 
 - (NSMenuItem *)dejal_addItemWithTitle:(NSString *)aString target:(id)target action:(SEL)aSelector keyEquivalent:(NSString *)keyEquiv modifierMask:(NSUInteger)modifierMask icon:(NSImage *)icon representedObject:(id)object tag:(NSInteger)tag;
 
+- (void)dejal_addItems:(NSArray *)items;
+
 - (NSInteger)dejal_removeItemWithTarget:(id)target andAction:(SEL)action;
 - (void)dejal_removeItemsWithTarget:(id)target andAction:(SEL)action;
 
 - (NSMenuItem *)dejal_itemWithTarget:(id)target andAction:(SEL)action;
 - (NSMenuItem *)dejal_itemWithTarget:(id)target action:(SEL)action tag:(NSInteger)tag;
+- (NSMenuItem *)dejal_itemWithRepresentedObject:(id)object;
+- (NSInteger)dejal_indexOfItemWithRepresentedObject:(id)object;
+- (NSMenuItem *)dejal_itemWithTag:(NSInteger)tag;
 
 - (void)dejal_setCheckedItemForTarget:(id)target andAction:(SEL)action withTag:(NSInteger)tag;
 
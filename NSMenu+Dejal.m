@@ -28,10 +28,314 @@
 //
 
 #import "NSMenu+Dejal.h"
+#import <objc/runtime.h>
+
+
+/**
+ Private record of the menu items with a particular target and action, in menu order, plus the first of them with each tag.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalMenuItemActionEntry : NSObject
+
+@property (nonatomic, strong) NSMutableArray *items;
+@property (nonatomic, strong) NSMutableDictionary *itemsByTag;
+
+@end
+
+
+@implementation DejalMenuItemActionEntry
+
+- (instancetype)init;
+{
+    if ((self = [super init]))
+    {
+        self.items = [NSMutableArray array];
+        self.itemsByTag = [NSMutableDictionary dictionary];
+    }
+    
+    return self;
+}
+
+@end
+
+
+/**
+ Private index of a menu's items by target and action (then tag), by represented object, and by tag, used when the menu's dejal_indexesItems property is enabled.  The represented object and tag tables hold the items with each key in menu order, so the first is found, as with a linear search, and removing it just promotes the next.  The position of each item in the menu is also recorded as it is added; removing an item other than the last shifts the later ones, so they are renumbered in one pass when next needed.  Keeps track of the number of items it knows about, so the menu can detect items added or removed by other means and rebuild it.
+ 
+ Targets are keyed by object identity in a map table without retaining them (not all AppKit classes support weak references), then by action selector.  Since a dead target's address could be reused by a new object, an entry is only trusted if its items still have that target (menu item targets are zeroing weak references); otherwise it is discarded, and the whole index rebuilt when next needed.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalMenuItemIndex : NSObject
+
+@property (nonatomic, strong) NSMapTable *entriesByTarget;
+@property (nonatomic, strong) NSMutableDictionary *entriesForNilTarget;
+@property (nonatomic, strong) NSMapTable *itemsByRepresentedObject;
+@property (nonatomic, strong) NSMutableDictionary *itemsByTag;
+@property (nonatomic, strong) NSMapTable *positionsByItem;
+@property (nonatomic) NSInteger itemCount;
+@property (nonatomic) BOOL positionsNeedUpdate;
+@property (nonatomic) BOOL needsRebuild;
+
+- (void)addItem:(NSMenuItem *)item;
+- (void)removeItem:(NSMenuItem *)item;
+
+- (NSArray *)itemsWithTarget:(id)target action:(SEL)action;
+- (NSMenuItem *)itemWithTarget:(id)target action:(SEL)action tag:(NSInteger)tag;
+- (NSMenuItem *)itemWithRepresentedObject:(id)object;
+- (NSMenuItem *)itemWithTag:(NSInteger)tag;
+- (NSInteger)positionOfItem:(NSMenuItem *)item inMenu:(NSMenu *)menu;
+
+@end
+
+
+@implementation DejalMenuItemIndex
+
+- (instancetype)init;
+{
+    if ((self = [super init]))
+    {
+        self.entriesByTarget = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+        self.entriesForNilTarget = [NSMutableDictionary dictionary];
+        self.itemsByRepresentedObject = [NSMapTable strongToStrongObjectsMapTable];
+        self.itemsByTag = [NSMutableDictionary dictionary];
+        self.positionsByItem = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    
+    return self;
+}
+
+/**
+ Returns the entry for the target and action, optionally creating it if not found.  Discards a stale entry left by a dead target at the same address.
+*/
+
+- (DejalMenuItemActionEntry *)entryForTarget:(id)target action:(SEL)action create:(BOOL)create;
+{
+    NSMutableDictionary *entries = target ? [self.entriesByTarget objectForKey:target] : self.entriesForNilTarget;
+    NSValue *actionKey = [NSValue valueWithPointer:action];
+    DejalMenuItemActionEntry *entry = entries[actionKey];
+    
+    if (entry.items.count && target && [entry.items.firstObject target] != target)
+    {
+        [self.entriesByTarget removeObjectForKey:target];
+        entries = nil;
+        entry = nil;
+        self.needsRebuild = YES;
+    }
+    
+    if (!entry && create)
+    {
+        if (!entries)
+        {
+            entries = [NSMutableDictionary dictionary];
+            
+            if (target)
+                [self.entriesByTarget setObject:entries forKey:target];
+            else
+                self.entriesForNilTarget = entries;
+        }
+        
+        entry = [DejalMenuItemActionEntry new];
+        entries[actionKey] = entry;
+    }
+    
+    return entry;
+}
+
+- (void)addItem:(NSMenuItem *)item;
+{
+    DejalMenuItemActionEntry *entry = [self entryForTarget:item.target action:item.action create:YES];
+    
+    [entry.items addObject:item];
+    
+    // Only the first item with each tag or represented object is found, as with a linear search:
+    if (!entry.itemsByTag[@(item.tag)])
+        entry.itemsByTag[@(item.tag)] = item;
+    
+    if (item.representedObject)
+        [self addItem:item toTable:self.itemsByRepresentedObject forKey:item.representedObject];
+    
+    [self addItem:item toTable:self.itemsByTag forKey:@(item.tag)];
+    
+    // Items are always added at the end of the menu:
+    if (!self.positionsNeedUpdate)
+        [self.positionsByItem setObject:@(self.itemCount) forKey:item];
+    
+    self.itemCount++;
+}
+
+/**
+ Appends the item to the list for the key in the table (a map table or dictionary).
+*/
+
+- (void)addItem:(NSMenuItem *)item toTable:(id)table forKey:(id)key;
+{
+    NSMutableArray *items = [table objectForKey:key];
+    
+    if (items)
+        [items addObject:item];
+    else
+        [table setObject:[NSMutableArray arrayWithObject:item] forKey:key];
+}
+
+/**
+ Removes the item from the list for the key in the table, removing the list if it's now empty.  Lists are usually one or a few items long, so this is effectively O(1).
+*/
+
+- (void)removeItem:(NSMenuItem *)item fromTable:(id)table forKey:(id)key;
+{
+    NSMutableArray *items = [table objectForKey:key];
+    
+    [items removeObjectIdenticalTo:item];
+    
+    if (items && !items.count)
+        [table removeObjectForKey:key];
+}
+
+- (void)removeItem:(NSMenuItem *)item;
+{
+    DejalMenuItemActionEntry *entry = [self entryForTarget:item.target action:item.action create:NO];
+    
+    [entry.items removeObjectIdenticalTo:item];
+    
+    if (entry.itemsByTag[@(item.tag)] == item)
+    {
+        [entry.itemsByTag removeObjectForKey:@(item.tag)];
+        
+        // Promote the next item with the same tag, if any:
+        for (NSMenuItem *otherItem in entry.items)
+        {
+            if (otherItem.tag == item.tag)
+            {
+                entry.itemsByTag[@(item.tag)] = otherItem;
+                break;
+            }
+        }
+    }
+    
+    if (item.representedObject)
+        [self removeItem:item fromTable:self.itemsByRepresentedObject forKey:item.representedObject];
+    
+    [self removeItem:item fromTable:self.itemsByTag forKey:@(item.tag)];
+    
+    // Removing the last item doesn't affect the positions of the others:
+    if ([[self.positionsByItem objectForKey:item] integerValue] != self.itemCount - 1)
+        self.positionsNeedUpdate = YES;
+    
+    [self.positionsByItem removeObjectForKey:item];
+    
+    self.itemCount--;
+}
+
+- (NSArray *)itemsWithTarget:(id)target action:(SEL)action;
+{
+    return [[self entryForTarget:target action:action create:NO].items copy] ?: @[];
+}
+
+- (NSMenuItem *)itemWithTarget:(id)target action:(SEL)action tag:(NSInteger)tag;
+{
+    return [self entryForTarget:target action:action create:NO].itemsByTag[@(tag)];
+}
+
+- (NSMenuItem *)itemWithRepresentedObject:(id)object;
+{
+    return object ? [[self.itemsByRepresentedObject objectForKey:object] firstObject] : nil;
+}
+
+- (NSMenuItem *)itemWithTag:(NSInteger)tag;
+{
+    return [self.itemsByTag[@(tag)] firstObject];
+}
+
+/**
+ Returns the position of the item in the menu, or -1 if it isn't indexed, renumbering the items first if any were removed from before the end.
+*/
+
+- (NSInteger)positionOfItem:(NSMenuItem *)item inMenu:(NSMenu *)menu;
+{
+    if (!item)
+        return -1;
+    
+    if (self.positionsNeedUpdate)
+    {
+        NSInteger position = 0;
+        
+        [self.positionsByItem removeAllObjects];
+        
+        for (NSMenuItem *menuItem in menu.itemArray)
+            [self.positionsByItem setObject:@(position++) forKey:menuItem];
+        
+        self.positionsNeedUpdate = NO;
+    }
+    
+    NSNumber *position = [self.positionsByItem objectForKey:item];
+    
+    return position ? position.integerValue : -1;
+}
+
+@end
 
 
 @implementation NSMenu (Dejal)
 
+/**
+ Whether or not the receiver maintains an index of its items by target and action, tag and represented object, to make the lookup, removal and checking methods below O(1) or O(k) instead of scanning all of the items.  Off by default; worthwhile for large menus that are frequently searched.  Items added via the dejal_addItemWithTitle: methods and removed via the dejal_remove methods keep the index current; if items are added or removed by other means, the change in the number of items is noticed and the index is rebuilt.  If the target, action, tag or represented object of an existing item is changed, call -dejal_invalidateItemIndex.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_indexesItems;
+{
+    return objc_getAssociatedObject(self, @selector(dejal_indexesItems)) != nil;
+}
+
+- (void)dejal_setIndexesItems:(BOOL)indexesItems;
+{
+    objc_setAssociatedObject(self, @selector(dejal_indexesItems), indexesItems ? @YES : nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    [self dejal_invalidateItemIndex];
+}
+
+/**
+ Discards the item index, if any; it will be rebuilt the next time it is needed.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_invalidateItemIndex;
+{
+    objc_setAssociatedObject(self, @selector(dejal_itemIndex), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+/**
+ Returns the item index, building it if needed, or nil if indexing isn't enabled.
+ 
+ @author DJS 2026-10.
+*/
+
+- (DejalMenuItemIndex *)dejal_itemIndex;
+{
+    if (!self.dejal_indexesItems)
+        return nil;
+    
+    DejalMenuItemIndex *itemIndex = objc_getAssociatedObject(self, @selector(dejal_itemIndex));
+    
+    if (!itemIndex || itemIndex.needsRebuild || itemIndex.itemCount != self.numberOfItems)
+    {
+        itemIndex = [DejalMenuItemIndex new];
+        
+        for (NSMenuItem *item in self.itemArray)
+            [itemIndex addItem:item];
+        
+        objc_setAssociatedObject(self, @selector(dejal_itemIndex), itemIndex, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    
+    return itemIndex;
+}
+
 /**
  Adds a separator item to the menu.
  
@@ -40,7 +344,7 @@
 
 - (void)dejal_addSeparatorItem;
 {
-    [self addItem:[NSMenuItem separatorItem]];
+    [self dejal_addItem:[NSMenuItem separatorItem]];
 }
 
 /**
@@ -109,6 +413,7 @@
  @author DJS 2004-01.
  @version DJS 2004-04: changed to add modifierMask.
  @version DJS 2008-07: changed to add tag.
+ @version DJS 2026-10: changed to update the item index, if enabled.
 */
 
 - (NSMenuItem *)dejal_addItemWithTitle:(NSString *)aString target:(id)target action:(SEL)aSelector
@@ -127,23 +432,77 @@
     [item setRepresentedObject:object];
     [item setTag:tag];
     
-    [self addItem:item];
+    [self dejal_addItem:item];
     
     return item;
 }
 
+/**
+ Adds the item to the end of the menu, like -addItem:, but also updates the item index, if enabled.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_addItem:(NSMenuItem *)item;
+{
+    DejalMenuItemIndex *itemIndex = [self dejal_itemIndex];
+    
+    [self addItem:item];
+    [itemIndex addItem:item];
+}
+
+/**
+ Adds all of the items in the array to the end of the menu in one pass, rather than one at a time, so observers see a single change instead of one per item.  Useful for populating large menus; create the items with e.g. +dejal_menuItemWithTitle:settings:.  The item index is updated, if enabled.
+ 
+ @param items An array of NSMenuItem instances that aren't already in a menu.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_addItems:(NSArray *)items;
+{
+    if (!items.count)
+        return;
+    
+    DejalMenuItemIndex *itemIndex = [self dejal_itemIndex];
+    
+    if ([self respondsToSelector:@selector(setItemArray:)])
+    {
+        self.itemArray = [self.itemArray arrayByAddingObjectsFromArray:items];
+    }
+    else
+    {
+        for (NSMenuItem *item in items)
+        {
+            [self addItem:item];
+        }
+    }
+    
+    for (NSMenuItem *item in items)
+    {
+        [itemIndex addItem:item];
+    }
+}
+
 /**
  Removes a menu item based on its target and action.  Returns its menu item index, in case adjacent items (e.g. a divider) also need to be deleted.
  
  @author DJS 2010-11.
+ @version DJS 2026-10: changed to use the item index, if enabled.
 */
 
 - (NSInteger)dejal_removeItemWithTarget:(id)target andAction:(SEL)action;
 {
-    NSInteger itemIndex = [self indexOfItemWithTarget:target andAction:action];
+    NSMenuItem *item = [self dejal_itemWithTarget:target andAction:action];
     
-    if (itemIndex >= 0)
-        [self removeItemAtIndex:itemIndex];
+    if (!item)
+        return -1;
+    
+    NSInteger itemIndex = [self indexOfItem:item];
+    DejalMenuItemIndex *index = [self dejal_itemIndex];
+    
+    [self removeItemAtIndex:itemIndex];
+    [index removeItem:item];
     
     return itemIndex;
 }
@@ -152,22 +511,33 @@
  Removes all menu items based on a target and action.
  
  @author DJS 2014-11.
+ @version DJS 2026-10: changed to find the items in a single pass, or via the item index if enabled, instead of searching again after each removal.
  */
 
 - (void)dejal_removeItemsWithTarget:(id)target andAction:(SEL)action;
 {
-    NSInteger itemIndex = -1;
+    DejalMenuItemIndex *index = action ? [self dejal_itemIndex] : nil;
     
-    do
+    if (index)
     {
-        itemIndex = [self indexOfItemWithTarget:target andAction:action];
-        
-        if (itemIndex >= 0)
+        for (NSMenuItem *item in [index itemsWithTarget:target action:action])
+        {
+            [self removeItem:item];
+            [index removeItem:item];
+        }
+    }
+    else
+    {
+        for (NSInteger itemIndex = self.numberOfItems - 1; itemIndex >= 0; itemIndex--)
         {
-            [self removeItemAtIndex:itemIndex];
+            NSMenuItem *item = [self itemAtIndex:itemIndex];
+            
+            if (item.target == target && (!action || item.action == action))
+            {
+                [self removeItemAtIndex:itemIndex];
+            }
         }
     }
-    while (itemIndex >= 0);
 }
 
 /**
@@ -178,10 +548,18 @@
  @returns The menu item or nil if no such menu item is in the menu.
  
  @author DJS 2014-10.
+ @version DJS 2026-10: changed to use the item index, if enabled.
  */
 
 - (NSMenuItem *)dejal_itemWithTarget:(id)target andAction:(SEL)action;
 {
+    DejalMenuItemIndex *index = action ? [self dejal_itemIndex] : nil;
+    
+    if (index)
+    {
+        return [index itemsWithTarget:target action:action].firstObject;
+    }
+    
     NSInteger idx = [self indexOfItemWithTarget:target andAction:action];
     
     if (idx >= 0)
@@ -203,10 +581,18 @@
  @returns The found menu item, or nil if none match.
  
  @author DJS 2014-10.
+ @version DJS 2026-10: changed to use the item index, if enabled.
  */
 
 - (NSMenuItem *)dejal_itemWithTarget:(id)target action:(SEL)action tag:(NSInteger)tag;
 {
+    DejalMenuItemIndex *index = [self dejal_itemIndex];
+    
+    if (index)
+    {
+        return [index itemWithTarget:target action:action tag:tag];
+    }
+    
     for (NSMenuItem *menuItem in self.itemArray)
     {
         if (menuItem.target == target && menuItem.action == action && menuItem.tag == tag)
@@ -218,6 +604,80 @@
     return nil;
 }
 
+/**
+ Returns the first menu item in the receiver with the given represented object (compared via -isEqual:), if any.
+ 
+ @param object A represented object value.
+ @returns The found menu item, or nil if none match.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSMenuItem *)dejal_itemWithRepresentedObject:(id)object;
+{
+    DejalMenuItemIndex *index = [self dejal_itemIndex];
+    
+    if (index)
+    {
+        return [index itemWithRepresentedObject:object];
+    }
+    
+    NSInteger idx = [self indexOfItemWithRepresentedObject:object];
+    
+    return idx >= 0 ? [self itemAtIndex:idx] : nil;
+}
+
+/**
+ Returns the index of the first menu item in the receiver with the given represented object (compared via -isEqual:), like -indexOfItemWithRepresentedObject:, but if the item index is enabled, both the item and its index are found via hash lookups.
+ 
+ @param object A represented object value.
+ @returns The index of the found menu item, or -1 if none match.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSInteger)dejal_indexOfItemWithRepresentedObject:(id)object;
+{
+    DejalMenuItemIndex *index = [self dejal_itemIndex];
+    
+    if (index)
+    {
+        NSMenuItem *item = [index itemWithRepresentedObject:object];
+        NSInteger position = [index positionOfItem:item inMenu:self];
+        
+        // Cheaply confirm the position, in case the menu was reordered by other means:
+        if (position >= 0 && position < self.numberOfItems && [self itemAtIndex:position] == item)
+        {
+            return position;
+        }
+        
+        return item ? [self indexOfItem:item] : -1;
+    }
+    
+    return [self indexOfItemWithRepresentedObject:object];
+}
+
+/**
+ Returns the first menu item in the receiver with the given tag, if any.  Like -itemWithTag:, but uses the item index, if enabled.
+ 
+ @param tag A menu item tag value.
+ @returns The found menu item, or nil if none match.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSMenuItem *)dejal_itemWithTag:(NSInteger)tag;
+{
+    DejalMenuItemIndex *index = [self dejal_itemIndex];
+    
+    if (index)
+    {
+        return [index itemWithTag:tag];
+    }
+    
+    return [self itemWithTag:tag];
+}
+
 /**
  Toggles the state of all menu items in the receiver with the given target and action, so that only the matching item with the specified tag value is checked, and matching items with other tag values are unchecked.
  
@@ -226,11 +686,15 @@
  @param tag A menu item tag value.
  
  @author DJS 2014-10.
+ @version DJS 2026-10: changed to only visit the matching items, if the item index is enabled.
  */
 
 - (void)dejal_setCheckedItemForTarget:(id)target andAction:(SEL)action withTag:(NSInteger)tag;
 {
-    for (NSMenuItem *menuItem in self.itemArray)
+    DejalMenuItemIndex *index = [self dejal_itemIndex];
+    NSArray *menuItems = index ? [index itemsWithTarget:target action:action] : self.itemArray;
+    
+    for (NSMenuItem *menuItem in menuItems)
     {
         if (menuItem.target == target && menuItem.action == action)
         {
@@ -56,26 +56,22 @@
 
 /**
  Returns an array containing the objects for the selected rows, or for all rows if none are selected and YES is passed.
+ 
+ @version DJS 2026-10: Changed to walk the row indexes directly, instead of via an enumerator of row numbers.
 */
 
 - (NSArray *)dejal_selectedOrAllItems:(BOOL)allIfNoneSelected
 {
-    NSMutableArray *items = [NSMutableArray array];
-    NSEnumerator *enumerator;
-    NSNumber *selRow = nil;
-
-    if (allIfNoneSelected)
-        enumerator = [self dejal_selectedOrAllRowsEnumerator];
-    else
-        enumerator = [self dejal_selectedRowsEnumerator];
+    NSIndexSet *rows = allIfNoneSelected ? self.dejal_selectedOrAllRowIndexes : self.selectedRowIndexes;
+    NSMutableArray *items = [NSMutableArray arrayWithCapacity:rows.count];
     
-    while ((selRow = [enumerator nextObject]))
-    {
-        id item = [self itemAtRow:[selRow integerValue]];
-        
-        if (item)
-            [items addObject:item];
-    }
+    [rows enumerateIndexesUsingBlock:^(NSUInteger row, BOOL *stop)
+     {
+         id item = [self itemAtRow:row];
+         
+         if (item)
+             [items addObject:item];
+     }];
 
     return items;
 }
@@ -30,12 +30,18 @@
 
 @interface NSPopUpButton (Dejal)
 
+@property (nonatomic, setter=dejal_setIndexesItems:) BOOL dejal_indexesItems;
+
+- (void)dejal_performBatchUpdates:(void (^)(void))updates;
+
 - (void)dejal_addSeparatorItem;
 
 - (NSMenuItem *)dejal_addItemWithTitle:(NSString *)aString tag:(NSInteger)tag;
 - (NSMenuItem *)dejal_addItemWithTitle:(NSString *)aString tag:(NSInteger)tag representedObject:(id)object;
 
+- (void)dejal_addItems:(NSArray *)items;
 - (void)dejal_addItemsWithPaths:(NSArray *)paths prefixDivider:(BOOL)prefixDivider tag:(NSInteger)tag abbreviatedObject:(BOOL)abbreviatedObject defaultPath:(NSString *)defaultPath;
+- (void)dejal_addItemsWithPaths:(NSArray *)paths prefixDivider:(BOOL)prefixDivider tag:(NSInteger)tag abbreviatedObject:(BOOL)abbreviatedObject defaultPath:(NSString *)defaultPath completionHandler:(void (^)(void))completion;
 
 - (NSMenuItem *)dejal_itemWithTag:(NSInteger)aTag;
 - (NSInteger)dejal_tagOfSelectedItem;
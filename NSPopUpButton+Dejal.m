@@ -28,11 +28,61 @@
 //
 
 #import "NSPopUpButton+Dejal.h"
+#import "NSMenu+Dejal.h"
 #import "NSString+Dejal.h"
+#import <objc/runtime.h>
 
 
 @implementation NSPopUpButton (Dejal)
 
+/**
+ Whether or not the receiver's menu maintains an index of its items, so -dejal_itemWithTag: and -dejal_selectItemWithRepresentedObject: find items (and their indexes) via hash lookups instead of scanning.  Items added via the dejal_add methods keep the index current.  See -[NSMenu dejal_indexesItems] for details.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_indexesItems;
+{
+    return [self menu].dejal_indexesItems;
+}
+
+- (void)dejal_setIndexesItems:(BOOL)indexesItems;
+{
+    [self menu].dejal_indexesItems = indexesItems;
+}
+
+/**
+ Invokes the block, deferring the title and selection synchronization normally done by the dejal_add methods until the end, so it is only done once however many items are added.  Batches can be nested; only the outermost one synchronizes.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_performBatchUpdates:(void (^)(void))updates;
+{
+    NSInteger depth = [objc_getAssociatedObject(self, @selector(dejal_performBatchUpdates:)) integerValue];
+    
+    objc_setAssociatedObject(self, @selector(dejal_performBatchUpdates:), @(depth + 1), OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    updates();
+    
+    objc_setAssociatedObject(self, @selector(dejal_performBatchUpdates:), depth ? @(depth) : nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    if (!depth)
+        [self synchronizeTitleAndSelectedItem];
+}
+
+/**
+ Synchronizes the title and selected item, unless within -dejal_performBatchUpdates:, which will do so at the end.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_synchronizeTitleAndSelectedItemIfNeeded;
+{
+    if (!objc_getAssociatedObject(self, @selector(dejal_performBatchUpdates:)))
+        [self synchronizeTitleAndSelectedItem];
+}
+
 /**
  Adds a separator item to the menu.
  
@@ -41,9 +91,9 @@
 
 - (void)dejal_addSeparatorItem;
 {
-    [[self menu] addItem:[NSMenuItem separatorItem]];
+    [[self menu] dejal_addItem:[NSMenuItem separatorItem]];
     
-    [self synchronizeTitleAndSelectedItem];
+    [self dejal_synchronizeTitleAndSelectedItemIfNeeded];
 }
 
 /**
@@ -58,9 +108,9 @@
     
     [item setTag:tag];
     
-    [[self menu] addItem:item];
+    [[self menu] dejal_addItem:item];
     
-    [self synchronizeTitleAndSelectedItem];
+    [self dejal_synchronizeTitleAndSelectedItemIfNeeded];
     
     return item;
 }
@@ -78,18 +128,120 @@
     [item setTag:tag];
     [item setRepresentedObject:object];
     
-    [[self menu] addItem:item];
+    [[self menu] dejal_addItem:item];
     
-    [self synchronizeTitleAndSelectedItem];
+    [self dejal_synchronizeTitleAndSelectedItemIfNeeded];
     
     return item;
 }
 
+/**
+ Adds all of the items in the array to the end of the menu in one pass, then synchronizes the title and selection once (or at the end of the batch, if within -dejal_performBatchUpdates:).
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_addItems:(NSArray *)items;
+{
+    [[self menu] dejal_addItems:items];
+    
+    [self dejal_synchronizeTitleAndSelectedItemIfNeeded];
+}
+
+/**
+ Computes the item titles and represented objects for the paths, as described for -dejal_addItemsWithPaths:prefixDivider:tag:abbreviatedObject:defaultPath:, returning an array of two-element arrays in the same order as the paths.  Large arrays of paths are split into chunks that are processed concurrently; this doesn't touch the popup, so is safe to call from any thread.
+ 
+ @author DJS 2026-10.
+*/
+
+static NSArray *DejalTitlesAndObjectsForPaths(NSArray *paths, BOOL abbreviatedObject, NSString *defaultPath)
+{
+    NSUInteger count = paths.count;
+    NSUInteger chunkSize = 256;
+    NSUInteger chunkCount = (count + chunkSize - 1) / chunkSize;
+    NSMutableArray *chunkResults = [NSMutableArray arrayWithCapacity:chunkCount];
+    
+    for (NSUInteger chunk = 0; chunk < chunkCount; chunk++)
+        [chunkResults addObject:[NSNull null]];
+    
+    void (^processChunk)(size_t) = ^(size_t chunk)
+    {
+        @autoreleasepool
+        {
+            NSRange range = NSMakeRange(chunk * chunkSize, MIN(chunkSize, count - chunk * chunkSize));
+            NSMutableArray *results = [NSMutableArray arrayWithCapacity:range.length];
+            
+            for (NSString *path in [paths subarrayWithRange:range])
+            {
+                NSString *title = [path dejal_lastPathComponentWithoutExtension];
+                NSString *object = path;
+                
+                if (defaultPath && ![object hasPrefix:@"/"])
+                    object = [defaultPath stringByAppendingPathComponent:object];
+                
+                if (abbreviatedObject)
+                    object = [object dejal_abbreviatedPath];
+                
+                [results addObject:@[title ?: @"", object ?: @""]];
+            }
+            
+            @synchronized (chunkResults)
+            {
+                chunkResults[chunk] = results;
+            }
+        }
+    };
+    
+    if (chunkCount > 1)
+    {
+        dispatch_apply(chunkCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), processChunk);
+    }
+    else if (chunkCount)
+    {
+        processChunk(0);
+    }
+    
+    NSMutableArray *titlesAndObjects = [NSMutableArray arrayWithCapacity:count];
+    
+    for (NSArray *results in chunkResults)
+        [titlesAndObjects addObjectsFromArray:results];
+    
+    return titlesAndObjects;
+}
+
+/**
+ Creates and adds items for the precomputed titles and represented objects.  Must be called on the main thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_addItemsWithTitlesAndObjects:(NSArray *)titlesAndObjects prefixDivider:(BOOL)prefixDivider tag:(NSInteger)tag;
+{
+    NSMutableArray *items = [NSMutableArray arrayWithCapacity:titlesAndObjects.count + 1];
+    
+    if (prefixDivider && titlesAndObjects.count)
+        [items addObject:[NSMenuItem separatorItem]];
+    
+    for (NSArray *titleAndObject in titlesAndObjects)
+    {
+        NSMenuItem *item = [[NSMenuItem alloc] initWithTitle:titleAndObject[0] action:nil keyEquivalent:@""];
+        
+        [item setTag:tag];
+        [item setRepresentedObject:titleAndObject[1]];
+        
+        [items addObject:item];
+    }
+    
+    [self dejal_addItems:items];
+}
+
 /**
  Given an array of file paths, adds items to the receiver.  The item titles are the last path components sans extensions, and the item tags are set as requested.  The item represented objects are set to the abbreviated or full paths, based on the abbreviatedObject value.  If prefixDivider is YES, a divider line is added before the other items, iff there are any.  You can call -pathsWithExtension:atPath:deepScan: (in NSFileManager+Dejal) to get the paths.
  
  @author DJS 2005-05.
  @version DJS 2014-01: changed to support a default path.
+ @version DJS 2026-10: changed to add all of the items in one pass and synchronize once.
+ @version DJS 2026-10: changed to compute the titles and represented objects of large arrays of paths concurrently.
 */
 
 - (void)dejal_addItemsWithPaths:(NSArray *)paths
@@ -98,42 +250,54 @@
         abbreviatedObject:(BOOL)abbreviatedObject
               defaultPath:(NSString *)defaultPath;
 {
-    NSString *path;
+    NSArray *titlesAndObjects = DejalTitlesAndObjectsForPaths(paths, abbreviatedObject, defaultPath);
     
-    for (path in paths)
-    {
-        if (prefixDivider)
-        {
-            [[self menu] addItem:[NSMenuItem separatorItem]];
-            prefixDivider = NO;
-        }
-        
-        NSString *title = [path dejal_lastPathComponentWithoutExtension];
-        NSString *object = path;
-        
-        if (defaultPath && ![object hasPrefix:@"/"])
-            object = [defaultPath stringByAppendingPathComponent:object];
-        
-        if (abbreviatedObject)
-            object = [object dejal_abbreviatedPath];
-        
-        [self dejal_addItemWithTitle:title tag:tag representedObject:object];
-    }
-    
-    [self synchronizeTitleAndSelectedItem];
+    [self dejal_addItemsWithTitlesAndObjects:titlesAndObjects prefixDivider:prefixDivider tag:tag];
 }
 
+/**
+ Like -dejal_addItemsWithPaths:prefixDivider:tag:abbreviatedObject:defaultPath:, but returns immediately, computing the item titles and represented objects on a background queue, then adding the items on the main thread and invoking the completion handler, if any.  Should be called on the main thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_addItemsWithPaths:(NSArray *)paths
+            prefixDivider:(BOOL)prefixDivider
+                      tag:(NSInteger)tag
+        abbreviatedObject:(BOOL)abbreviatedObject
+              defaultPath:(NSString *)defaultPath
+        completionHandler:(void (^)(void))completion;
+{
+    NSArray *pathsCopy = [paths copy];
+    NSString *defaultPathCopy = [defaultPath copy];
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^
+                   {
+                       NSArray *titlesAndObjects = DejalTitlesAndObjectsForPaths(pathsCopy, abbreviatedObject, defaultPathCopy);
+                       
+                       dispatch_async(dispatch_get_main_queue(), ^
+                                      {
+                                          [self dejal_addItemsWithTitlesAndObjects:titlesAndObjects prefixDivider:prefixDivider tag:tag];
+                                          
+                                          if (completion)
+                                          {
+                                              completion();
+                                          }
+                                      });
+                   });
+}
 
 /**
  Convenience method to return the menu item with the given tag.
  
  @author DJS 2004-03.
+ @version DJS 2026-10: changed to use the item index, if enabled.
 */
 
 - (NSMenuItem *)dejal_itemWithTag:(NSInteger)aTag
 {
     NSMenu *menu = [self menu];
-    NSMenuItem *item = [menu itemWithTag:aTag];
+    NSMenuItem *item = [menu dejal_itemWithTag:aTag];
     
     return item;
 }
@@ -150,14 +314,18 @@
 }
 
 /**
- Convenience method to select the menu item with the given represented object.
+ Convenience method to select the menu item with the given represented object.  Returns the index of that item, or -1 if there is no such item, in which case the selection is left unchanged.  If the item index is enabled, the item and its index are found via hash lookups rather than by comparing every item with -isEqual:.
  
  @author DJS 2005-05.
+ @version DJS 2026-10: changed to use the item index, if enabled, and handle the object not being found.
 */
 
 - (NSInteger)dejal_selectItemWithRepresentedObject:(id)anObj
 {
-    NSUInteger i = [self indexOfItemWithRepresentedObject:anObj];
+    NSInteger i = [[self menu] dejal_indexOfItemWithRepresentedObject:anObj];
+    
+    if (i < 0)
+        return -1;
     
     [self selectItemAtIndex:i];
     
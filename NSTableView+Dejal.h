@@ -42,6 +42,10 @@
 - (BOOL)tableView:(NSTableView *)tableView deleteRowIndexes:(NSIndexSet *)indexes;
 
 - (NSString *)tableView:(NSTableView *)tableView stringValueForRow:(NSInteger)row;
+- (NSArray *)tableView:(NSTableView *)tableView stringValuesForRowIndexes:(NSIndexSet *)indexes;
+- (BOOL)tableViewStringValuesAreThreadSafe:(NSTableView *)tableView;
+- (NSAttributedString *)tableView:(NSTableView *)tableView attributedStringValueForRow:(NSInteger)row;
+- (BOOL)tableView:(NSTableView *)tableView pasteFromPasteboard:(NSPasteboard *)pboard beforeRow:(NSInteger)row;
 
 - (NSImage *)tableView:(NSTableView *)tableView dragImageForRowsWithIndexes:(NSIndexSet *)dragRows tableColumns:(NSArray *)tableColumns event:(NSEvent *)dragEvent offset:(NSPointPointer)dragImageOffset;
 
@@ -68,6 +72,9 @@
 - (NSEnumerator *)dejal_selectedOrAllRowsEnumerator;
 - (NSEnumerator *)dejal_multipleSelectedOrAllRowsEnumerator;
 
+- (void)dejal_enumerateSelectedOrAllRowsUsingBlock:(void (^)(NSUInteger row, BOOL *stop))block;
+- (void)dejal_enumerateMultipleSelectedOrAllRowsUsingBlock:(void (^)(NSUInteger row, BOOL *stop))block;
+
 - (void)dejal_selectFirstRowExtendingSelection:(BOOL)extendSel;
 - (void)dejal_selectLastRowExtendingSelection:(BOOL)extendSel;
 - (void)dejal_selectRowIndex:(NSUInteger)rowIndex byExtendingSelection:(BOOL)extendSel;
@@ -106,7 +113,16 @@
 - (void)dejal_reselectEditWithKey:(NSString *)key forDictionary:(NSDictionary *)dict;
 - (void)dejal_reselectEditWithKey:(NSString *)key forDictionary:(NSDictionary *)dict column:(NSInteger)column;
 
+@property (nonatomic, setter=dejal_setCachesRowHeights:) BOOL dejal_cachesRowHeights;
+
+- (CGFloat)dejal_heightOfRow:(NSUInteger)row;
 - (CGFloat)dejal_contentHeight;
+- (CGFloat)dejal_contentHeightUpToRow:(NSInteger)row;
+
+- (void)dejal_invalidateContentHeightForRowIndexes:(NSIndexSet *)indexes;
+- (void)dejal_invalidateContentHeightForInsertedRowIndexes:(NSIndexSet *)indexes;
+- (void)dejal_invalidateContentHeightForRemovedRowIndexes:(NSIndexSet *)indexes;
+- (void)dejal_invalidateContentHeight;
 
 @end
 
@@ -124,7 +140,16 @@
 - (IBAction)delete:(id)sender;
 
 - (BOOL)dejal_savePlainTextToURL:(NSURL *)url;
+- (BOOL)dejal_savePlainTextToURL:(NSURL *)url progressHandler:(BOOL (^)(NSUInteger rowsDone, NSUInteger totalRows))progressHandler error:(NSError **)error;
 - (BOOL)dejal_saveRichTextToURL:(NSURL *)url;
+- (BOOL)dejal_saveRichTextToURL:(NSURL *)url progressHandler:(BOOL (^)(NSUInteger rowsDone, NSUInteger totalRows))progressHandler error:(NSError **)error;
+
+- (BOOL)dejal_enumeratePlainTextDataForIndexes:(NSIndexSet *)indexes batchSize:(NSUInteger)batchSize usingBlock:(void (^)(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop))block;
+- (BOOL)dejal_writePlainTextForIndexes:(NSIndexSet *)indexes toFileHandle:(NSFileHandle *)fileHandle progressHandler:(BOOL (^)(NSUInteger rowsDone, NSUInteger totalRows))progressHandler;
+- (NSData *)dejal_plainTextDataForIndexes:(NSIndexSet *)indexes;
+- (NSData *)dejal_richTextDataForIndexes:(NSIndexSet *)indexes;
+- (BOOL)dejal_doCopyIndexes:(NSIndexSet *)indexes;
+- (BOOL)dejal_doLazyCopyIndexes:(NSIndexSet *)indexes;
 
 - (BOOL)validateMenuItem:(NSMenuItem *)item;
 
@@ -134,6 +159,10 @@
 - (NSIndexSet *)dejal_shouldSaveRowIndexes;
 
 - (NSString *)dejal_stringValueForRow:(NSUInteger)row;
+- (NSArray *)dejal_stringValuesForRowIndexes:(NSIndexSet *)indexes;
+- (NSAttributedString *)dejal_attributedStringValueForRow:(NSUInteger)row;
+
+- (BOOL)dejal_pasteFromPasteboard:(NSPasteboard *)pboard beforeRow:(NSInteger)row;
 
 - (BOOL)dejal_canDeleteRowIndexes:(NSIndexSet *)indexes;
 - (BOOL)dejal_deleteRowIndexes:(NSIndexSet *)indexes;
@@ -33,6 +33,8 @@
 #import "NSImage+Dejal.h"
 #import "NSWindow+Dejal.h"
 #import "NSDictionary+Dejal.h"
+#import <objc/runtime.h>
+#import <CoreText/CoreText.h>
 
 
 @interface NSObject (DejalTableViewCutCopyPasteDeleteDelegate)
@@ -42,6 +44,10 @@
 - (NSInteger)tableView:(NSTableView *)tableView shouldPasteBeforeRow:(NSInteger)row;
 
 - (NSString *)tableView:(NSTableView *)tableView stringValueForRow:(NSInteger)row;
+- (NSArray *)tableView:(NSTableView *)tableView stringValuesForRowIndexes:(NSIndexSet *)indexes;
+- (BOOL)tableViewStringValuesAreThreadSafe:(NSTableView *)tableView;
+- (NSAttributedString *)tableView:(NSTableView *)tableView attributedStringValueForRow:(NSInteger)row;
+- (BOOL)tableView:(NSTableView *)tableView pasteFromPasteboard:(NSPasteboard *)pboard beforeRow:(NSInteger)row;
 
 @end
 
@@ -58,6 +64,428 @@
 // ----------------------------------------------------------------------------------------
 
 
+/**
+ Private enumerator of row numbers, that walks an index set lazily instead of building an array of all of the rows up front.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalRowIndexEnumerator : NSEnumerator
+
+@property (nonatomic, strong) NSIndexSet *indexes;
+@property (nonatomic) NSUInteger nextRow;
+
+- (instancetype)initWithIndexes:(NSIndexSet *)indexes;
+
+@end
+
+
+@implementation DejalRowIndexEnumerator
+
+- (instancetype)initWithIndexes:(NSIndexSet *)indexes;
+{
+    if ((self = [super init]))
+    {
+        self.indexes = indexes;
+        self.nextRow = indexes.firstIndex;
+    }
+    
+    return self;
+}
+
+- (id)nextObject;
+{
+    NSUInteger row = self.nextRow;
+    
+    if (row == NSNotFound)
+        return nil;
+    
+    self.nextRow = [self.indexes indexGreaterThanIndex:row];
+    
+    return @(row);
+}
+
+- (NSArray *)allObjects;
+{
+    NSUInteger row = self.nextRow;
+    
+    if (row == NSNotFound)
+        return @[];
+    
+    NSMutableIndexSet *remaining = [self.indexes mutableCopy];
+    
+    [remaining removeIndexesInRange:NSMakeRange(0, row)];
+    
+    NSMutableArray *rows = [NSMutableArray arrayWithCapacity:remaining.count];
+    
+    [remaining enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop)
+     {
+         [rows addObject:@(idx)];
+     }];
+    
+    self.nextRow = NSNotFound;
+    
+    return rows;
+}
+
+@end
+
+
+/**
+ Private cache of row heights for -dejal_contentHeight and related methods, stored as a Fenwick (binary indexed) tree, so the total height, the height up to a row, and changing the height of a row are all O(log n).  The raw heights are also kept, so inserting or removing rows only needs to ask for the heights of new rows.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalRowHeightCache : NSObject
+
+@property (nonatomic) CGFloat *heights;
+@property (nonatomic) CGFloat *tree;
+@property (nonatomic) NSUInteger count;
+@property (nonatomic) CGFloat rowHeight;
+
+- (void)resetWithCount:(NSUInteger)count heightForRow:(CGFloat (^)(NSUInteger row))heightForRow;
+- (void)insertRowsAtIndexes:(NSIndexSet *)indexes heightForRow:(CGFloat (^)(NSUInteger row))heightForRow;
+- (void)removeRowsAtIndexes:(NSIndexSet *)indexes;
+- (void)setHeight:(CGFloat)height forRow:(NSUInteger)row;
+- (CGFloat)heightUpToRow:(NSUInteger)row;
+
+@end
+
+
+@implementation DejalRowHeightCache
+
+- (void)dealloc;
+{
+    free(self.heights);
+    free(self.tree);
+}
+
+/**
+ Rebuilds the tree from the raw heights in O(n), by pushing each node's sum up to its parent.
+*/
+
+- (void)rebuildTree;
+{
+    CGFloat *tree = self.tree;
+    NSUInteger count = self.count;
+    
+    for (NSUInteger i = 1; i <= count; i++)
+        tree[i] = self.heights[i - 1];
+    
+    for (NSUInteger i = 1; i <= count; i++)
+    {
+        NSUInteger parent = i + (i & -i);
+        
+        if (parent <= count)
+            tree[parent] += tree[i];
+    }
+}
+
+/**
+ Replaces the cached heights with the specified number of rows, getting each height via the block.
+*/
+
+- (void)resetWithCount:(NSUInteger)count heightForRow:(CGFloat (^)(NSUInteger row))heightForRow;
+{
+    self.heights = reallocf(self.heights, MAX(count, 1) * sizeof(CGFloat));
+    self.tree = reallocf(self.tree, (count + 1) * sizeof(CGFloat));
+    self.count = count;
+    
+    for (NSUInteger row = 0; row < count; row++)
+        self.heights[row] = heightForRow(row);
+    
+    [self rebuildTree];
+}
+
+/**
+ Inserts rows at the indexes, getting each new height via the block, and shifting the existing heights.
+*/
+
+- (void)insertRowsAtIndexes:(NSIndexSet *)indexes heightForRow:(CGFloat (^)(NSUInteger row))heightForRow;
+{
+    NSUInteger newCount = self.count + indexes.count;
+    CGFloat *oldHeights = self.heights;
+    CGFloat *newHeights = malloc(MAX(newCount, 1) * sizeof(CGFloat));
+    NSUInteger oldRow = 0;
+    
+    for (NSUInteger row = 0; row < newCount; row++)
+    {
+        if ([indexes containsIndex:row])
+            newHeights[row] = heightForRow(row);
+        else
+            newHeights[row] = oldHeights[oldRow++];
+    }
+    
+    free(oldHeights);
+    self.heights = newHeights;
+    self.tree = reallocf(self.tree, (newCount + 1) * sizeof(CGFloat));
+    self.count = newCount;
+    
+    [self rebuildTree];
+}
+
+/**
+ Removes the rows at the indexes, shifting the remaining heights.
+*/
+
+- (void)removeRowsAtIndexes:(NSIndexSet *)indexes;
+{
+    CGFloat *heights = self.heights;
+    NSUInteger newCount = 0;
+    
+    for (NSUInteger row = 0; row < self.count; row++)
+    {
+        if (![indexes containsIndex:row])
+            heights[newCount++] = heights[row];
+    }
+    
+    self.count = newCount;
+    
+    [self rebuildTree];
+}
+
+- (void)setHeight:(CGFloat)height forRow:(NSUInteger)row;
+{
+    if (row >= self.count)
+        return;
+    
+    CGFloat delta = height - self.heights[row];
+    
+    self.heights[row] = height;
+    
+    for (NSUInteger i = row + 1; i <= self.count; i += (i & -i))
+        self.tree[i] += delta;
+}
+
+/**
+ Returns the sum of the heights of the rows before the specified row, i.e. rows 0 through row - 1.
+*/
+
+- (CGFloat)heightUpToRow:(NSUInteger)row;
+{
+    CGFloat height = 0.0;
+    
+    for (NSUInteger i = MIN(row, self.count); i > 0; i -= (i & -i))
+        height += self.tree[i];
+    
+    return height;
+}
+
+@end
+
+
+/**
+ Private entry in the truncation cache, linked into a doubly linked list in order of use.  The links are unretained, since the cache's dictionary owns the entries.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalTruncationCacheEntry : NSObject
+
+@property (nonatomic, copy) NSString *key;
+@property (nonatomic, copy) NSString *truncatedString;
+@property (nonatomic, unsafe_unretained) DejalTruncationCacheEntry *previous;
+@property (nonatomic, unsafe_unretained) DejalTruncationCacheEntry *next;
+
+@end
+
+
+@implementation DejalTruncationCacheEntry
+
+@end
+
+
+/**
+ Private per-column cache of truncated strings, for -dejal_truncatedString:withIndicator:forTableColumn:.  Entries are keyed by the original string, and the whole cache is discarded when the font, indicator or column geometry changes, so the key doesn't need to include them.  The entries are also kept in a doubly linked list from least to most recently used, so a hit and evicting the least recently used entry when the cache is full are both O(1).
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalTruncationCache : NSObject
+
+@property (nonatomic, strong) NSFont *font;
+@property (nonatomic, copy) NSString *indicator;
+@property (nonatomic) CGFloat columnWidth;
+@property (nonatomic) CGFloat rowHeight;
+@property (nonatomic) CGFloat availableWidth;
+@property (nonatomic) NSUInteger capacity;
+@property (nonatomic, strong) NSMutableDictionary *entries;
+@property (nonatomic, unsafe_unretained) DejalTruncationCacheEntry *oldestEntry;
+@property (nonatomic, unsafe_unretained) DejalTruncationCacheEntry *newestEntry;
+
+- (BOOL)matchesFont:(NSFont *)font indicator:(NSString *)indicator columnWidth:(CGFloat)columnWidth rowHeight:(CGFloat)rowHeight;
+- (void)resetWithFont:(NSFont *)font indicator:(NSString *)indicator columnWidth:(CGFloat)columnWidth rowHeight:(CGFloat)rowHeight availableWidth:(CGFloat)availableWidth;
+
+- (NSString *)truncatedStringForString:(NSString *)string;
+- (void)setTruncatedString:(NSString *)truncatedString forString:(NSString *)string;
+
+@end
+
+
+@implementation DejalTruncationCache
+
+- (instancetype)init;
+{
+    if ((self = [super init]))
+    {
+        self.capacity = 1000;
+        self.entries = [NSMutableDictionary dictionary];
+    }
+    
+    return self;
+}
+
+- (BOOL)matchesFont:(NSFont *)font indicator:(NSString *)indicator columnWidth:(CGFloat)columnWidth rowHeight:(CGFloat)rowHeight;
+{
+    return self.columnWidth == columnWidth && self.rowHeight == rowHeight && (self.font == font || [self.font isEqual:font]) && (self.indicator == indicator || [self.indicator isEqualToString:indicator]);
+}
+
+- (void)resetWithFont:(NSFont *)font indicator:(NSString *)indicator columnWidth:(CGFloat)columnWidth rowHeight:(CGFloat)rowHeight availableWidth:(CGFloat)availableWidth;
+{
+    self.font = font;
+    self.indicator = indicator;
+    self.columnWidth = columnWidth;
+    self.rowHeight = rowHeight;
+    self.availableWidth = availableWidth;
+    
+    self.oldestEntry = nil;
+    self.newestEntry = nil;
+    [self.entries removeAllObjects];
+}
+
+/**
+ Removes the entry from the usage list, without removing it from the dictionary.
+*/
+
+- (void)unlinkEntry:(DejalTruncationCacheEntry *)entry;
+{
+    if (entry.previous)
+        entry.previous.next = entry.next;
+    else
+        self.oldestEntry = entry.next;
+    
+    if (entry.next)
+        entry.next.previous = entry.previous;
+    else
+        self.newestEntry = entry.previous;
+    
+    entry.previous = nil;
+    entry.next = nil;
+}
+
+/**
+ Adds the entry to the most recently used end of the usage list.
+*/
+
+- (void)appendEntry:(DejalTruncationCacheEntry *)entry;
+{
+    entry.previous = self.newestEntry;
+    entry.next = nil;
+    
+    if (self.newestEntry)
+        self.newestEntry.next = entry;
+    else
+        self.oldestEntry = entry;
+    
+    self.newestEntry = entry;
+}
+
+- (NSString *)truncatedStringForString:(NSString *)string;
+{
+    DejalTruncationCacheEntry *entry = self.entries[string];
+    
+    if (entry && entry != self.newestEntry)
+    {
+        // Move to the most recently used end:
+        [self unlinkEntry:entry];
+        [self appendEntry:entry];
+    }
+    
+    return entry.truncatedString;
+}
+
+- (void)setTruncatedString:(NSString *)truncatedString forString:(NSString *)string;
+{
+    DejalTruncationCacheEntry *entry = self.entries[string];
+    
+    if (entry)
+    {
+        entry.truncatedString = truncatedString;
+        [self unlinkEntry:entry];
+        [self appendEntry:entry];
+        return;
+    }
+    
+    if (self.entries.count >= self.capacity && self.oldestEntry)
+    {
+        DejalTruncationCacheEntry *oldestEntry = self.oldestEntry;
+        
+        [self unlinkEntry:oldestEntry];
+        [self.entries removeObjectForKey:oldestEntry.key];
+    }
+    
+    entry = [DejalTruncationCacheEntry new];
+    entry.key = string;
+    entry.truncatedString = truncatedString;
+    
+    self.entries[entry.key] = entry;
+    [self appendEntry:entry];
+}
+
+@end
+
+
+/**
+ Returns the string either intact, or truncated with the indicator appended if it is too wide for the width in the font.  The string is laid out once, then the truncation point is found by a binary search on the glyph offsets of that layout, rather than by repeatedly measuring shorter strings.  Composed character sequences are never split.
+ 
+ @author DJS 2026-10.
+*/
+
+static NSString *DejalTruncatedStringForWidth(NSString *string, NSString *indicator, NSFont *font, CGFloat width)
+{
+    NSDictionary *attributes = font ? @{NSFontAttributeName : font} : @{};
+    NSAttributedString *attributedString = [[NSAttributedString alloc] initWithString:string attributes:attributes];
+    CTLineRef line = CTLineCreateWithAttributedString((__bridge CFAttributedStringRef)attributedString);
+    
+    if (CTLineGetTypographicBounds(line, NULL, NULL, NULL) <= width)
+    {
+        CFRelease(line);
+        return string;
+    }
+    
+    if (!indicator)
+        indicator = @"";
+    
+    CGFloat available = width - [indicator sizeWithAttributes:attributes].width;
+    NSUInteger low = 0;
+    NSUInteger high = string.length;
+    
+    // Find the longest prefix whose end offset fits in the available width:
+    while (low < high)
+    {
+        NSUInteger mid = (low + high + 1) / 2;
+        
+        if (CTLineGetOffsetForStringIndex(line, mid, NULL) <= available)
+            low = mid;
+        else
+            high = mid - 1;
+    }
+    
+    CFRelease(line);
+    
+    if (low > 0 && low < string.length)
+        low = [string rangeOfComposedCharacterSequenceAtIndex:low].location;
+    
+    return [[string substringToIndex:low] stringByAppendingString:indicator];
+}
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
+
+
 @implementation NSTableView (Dejal)
 
 /**
@@ -84,12 +512,13 @@
  Returns an index set including all rows.
  
  @author DJS 2010-05.
+ @version DJS 2026-10: Changed to include the last row.
 */
 
 - (NSIndexSet *)dejal_allRowIndexes;
 {
     if ([self numberOfRows])
-	    return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, [self numberOfRows] - 1)];
+	    return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, [self numberOfRows])];
     else
         return [NSIndexSet indexSet];
 }
@@ -123,39 +552,27 @@
 }
 
 /**
- Returns an enumerator of row numbers for all table rows.
+ Returns an enumerator of row numbers for all table rows.  The row numbers are generated as the enumerator is iterated, rather than up front.
  
  @author DJS 2004-05.
+ @version DJS 2026-10: Changed to enumerate lazily.
 */
 
 - (NSEnumerator *)dejal_rowEnumerator
 {
-    NSMutableArray *array = [NSMutableArray arrayWithCapacity:[self numberOfRows]];
-    NSInteger row;
-    
-    for (row = 0; row < [self numberOfRows]; row++)
-        [array addObject:@(row)];
-    
-    return [array objectEnumerator];
+    return [[DejalRowIndexEnumerator alloc] initWithIndexes:self.dejal_allRowIndexes];
 }
 
 /**
- Returns an enumerator of row numbers for selected table rows.  Replacement for the deprecated -selectedRowEnumerator method.
+ Returns an enumerator of row numbers for selected table rows.  Replacement for the deprecated -selectedRowEnumerator method.  The row numbers are generated as the enumerator is iterated, walking the selected index ranges rather than every row.
  
  @author DJS 2009-09.
+ @version DJS 2026-10: Changed to enumerate lazily.
 */
 
 - (NSEnumerator *)dejal_selectedRowsEnumerator;
 {
-    NSIndexSet *selectedRows = self.selectedRowIndexes;
-    NSMutableArray *array = [NSMutableArray arrayWithCapacity:[selectedRows count]];
-    NSInteger row;
-    
-    for (row = 0; row < [self numberOfRows]; row++)
-        if ([selectedRows containsIndex:row])
-            [array addObject:@(row)];
-    
-    return [array objectEnumerator];
+    return [[DejalRowIndexEnumerator alloc] initWithIndexes:self.selectedRowIndexes];
 }
 
 /**
@@ -186,6 +603,28 @@
         return [self dejal_rowEnumerator];
 }
 
+/**
+ Invokes the block for each of the selected rows, if there are some selected, or all rows, if none are selected.  Walks the index ranges directly, so no row numbers are boxed.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_enumerateSelectedOrAllRowsUsingBlock:(void (^)(NSUInteger row, BOOL *stop))block;
+{
+    [self.dejal_selectedOrAllRowIndexes enumerateIndexesUsingBlock:block];
+}
+
+/**
+ Invokes the block for each of the selected rows, if there are more than one selected, or all rows, if none or one are selected.  Walks the index ranges directly, so no row numbers are boxed.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_enumerateMultipleSelectedOrAllRowsUsingBlock:(void (^)(NSUInteger row, BOOL *stop))block;
+{
+    [self.dejal_multipleSelectedOrAllRowIndexes enumerateIndexesUsingBlock:block];
+}
+
 /**
  Selects the first row, either as well as any existing selection, or instead.
  
@@ -488,15 +927,45 @@
 /**
  Returns the specified string either intact, or truncated with the indicator string added if the original string is too long to fit in the table column.  The indicator string would typically be an ellipsis (...).  This method is ideal to call in your -tableView:objectValueForTableColumn:row: data source method.
  
+ The results are cached per column, keyed on the string, and the cache is discarded whenever the column's font or width, the row height, or the indicator changes, so repeated calls while scrolling don't re-measure anything.
+ 
  @author DJS 2004-01.
+ @version DJS 2026-10: Changed to cache results per column, and to measure each string only once.
 */
 
 - (NSString *)dejal_truncatedString:(NSString *)string withIndicator:(NSString *)indicator forTableColumn:(NSTableColumn *)tableColumn
 { 
+    if (!string.length || !tableColumn)
+        return string;
+    
     NSCell *cell = [tableColumn dataCell];
-    NSInteger desiredWidth = [cell titleRectForBounds:NSMakeRect(0, 0, [tableColumn width] - 50, [self rowHeight])].size.width;
+    NSFont *font = [cell font];
+    CGFloat columnWidth = [tableColumn width];
+    CGFloat rowHeight = [self rowHeight];
+    DejalTruncationCache *cache = objc_getAssociatedObject(tableColumn, @selector(dejal_truncatedString:withIndicator:forTableColumn:));
+    
+    if (!cache)
+    {
+        cache = [DejalTruncationCache new];
+        objc_setAssociatedObject(tableColumn, @selector(dejal_truncatedString:withIndicator:forTableColumn:), cache, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    
+    if (![cache matchesFont:font indicator:indicator columnWidth:columnWidth rowHeight:rowHeight])
+    {
+        NSInteger desiredWidth = [cell titleRectForBounds:NSMakeRect(0, 0, columnWidth - 50, rowHeight)].size.width;
+        
+        [cache resetWithFont:font indicator:indicator columnWidth:columnWidth rowHeight:rowHeight availableWidth:desiredWidth];
+    }
+    
+    NSString *truncatedString = [cache truncatedStringForString:string];
+    
+    if (!truncatedString)
+    {
+        truncatedString = DejalTruncatedStringForWidth(string, indicator, font, cache.availableWidth);
+        [cache setTruncatedString:truncatedString forString:string];
+    }
     
-    return [string dejal_truncatedStringWithIndicator:indicator forFont:[cell font] withWidth:desiredWidth];
+    return truncatedString;
 }
 
 /**
@@ -527,6 +996,7 @@
 - (void)dejal_addKey:(NSString *)key withValue:(NSString *)value toDictionary:(NSMutableDictionary *)dict;
 {
     [self reloadData];
+    [self dejal_invalidateContentHeight];
     
     NSString *composedKey = key;
     NSInteger extra = 2;
@@ -541,6 +1011,7 @@
     }
     
     [self reloadData];
+    [self dejal_invalidateContentHeight];
     
     NSInteger row = [[dict dejal_sortedKeys] indexOfObject:composedKey];
     NSInteger column = [self dejal_indexOfFirstEditableTableColumn];
@@ -579,6 +1050,7 @@
     [dict removeObjectForKey:key];
     
     [self reloadData];
+    [self dejal_invalidateContentHeight];
 }
 
 /**
@@ -611,6 +1083,7 @@
     dispatch_after(doTime, dispatch_get_main_queue(), ^
                    {
                        [self reloadData];
+                       [self dejal_invalidateContentHeight];
                        
                        NSInteger row = [[dict dejal_sortedKeys] indexOfObject:key];
                        NSInteger editColumn = self.editedColumn + 1;
@@ -637,23 +1110,448 @@
 }
 
 /**
- Returns the current height of all rows in a view-based table view.  Doesn't currently support cell based table views.
+ Returns the height of the specified row, without creating any views: from the delegate's -tableView:heightOfRow: if implemented, or from the row rect if the table uses automatic row heights, otherwise the standard row height.  Excludes the intercell spacing.
  
- @author DJS 2013-02.
+ @author DJS 2026-10.
 */
 
-- (CGFloat)dejal_contentHeight;
+- (CGFloat)dejal_heightOfRow:(NSUInteger)row;
 {
-    CGFloat height = 0.0;
-    
-    for (NSInteger row = 0; row < [self numberOfRows]; row++)
-    {
-        NSView *view = [self viewAtColumn:0 row:row makeIfNecessary:YES];
-        
-        height += view.frame.size.height + self.intercellSpacing.height;
-    }
+    id <DejalTableViewDelegate> delegate = [self dejal_delegate];
     
-    return height;
+    if ([delegate respondsToSelector:@selector(tableView:heightOfRow:)])
+        return [delegate tableView:self heightOfRow:row];
+    else if ([self respondsToSelector:@selector(usesAutomaticRowHeights)] && self.usesAutomaticRowHeights)
+        return NSHeight([self rectOfRow:row]) - self.intercellSpacing.height;
+    else
+        return self.rowHeight;
+}
+
+/**
+ Whether or not -dejal_contentHeight and -dejal_contentHeightUpToRow: use a cache of the row heights, making them O(log n) instead of O(n).  Off by default, so those methods always return fresh results.  When on, the cache is rebuilt automatically if the number of rows or the standard row height changes, but the invalidation methods below must be called when rows are reloaded, inserted, removed or change height by other means.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_cachesRowHeights;
+{
+    return objc_getAssociatedObject(self, @selector(dejal_cachesRowHeights)) != nil;
+}
+
+- (void)dejal_setCachesRowHeights:(BOOL)cachesRowHeights;
+{
+    objc_setAssociatedObject(self, @selector(dejal_cachesRowHeights), cachesRowHeights ? @YES : nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    [self dejal_invalidateContentHeight];
+}
+
+/**
+ Returns the row height cache for the receiver, creating and populating it if needed, or repopulating it if the number of rows or the standard row height (e.g. after a font change) has changed without the cache being told.  Returns nil if caching isn't enabled.
+ 
+ @author DJS 2026-10.
+*/
+
+- (DejalRowHeightCache *)dejal_rowHeightCache;
+{
+    if (!self.dejal_cachesRowHeights)
+        return nil;
+    
+    DejalRowHeightCache *cache = objc_getAssociatedObject(self, @selector(dejal_rowHeightCache));
+    NSInteger numberOfRows = [self numberOfRows];
+    
+    if (!cache)
+    {
+        cache = [DejalRowHeightCache new];
+        objc_setAssociatedObject(self, @selector(dejal_rowHeightCache), cache, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+        cache.count = NSNotFound;
+    }
+    
+    if (cache.count != (NSUInteger)numberOfRows || cache.rowHeight != self.rowHeight)
+    {
+        [cache resetWithCount:numberOfRows heightForRow:^CGFloat(NSUInteger row)
+         {
+             return [self dejal_heightOfRow:row];
+         }];
+        
+        cache.rowHeight = self.rowHeight;
+    }
+    
+    return cache;
+}
+
+/**
+ Returns the current height of all rows, including the intercell spacing.  Works with both view-based and cell-based table views, and doesn't create any views.  If dejal_cachesRowHeights is enabled, the row heights are cached, so this is O(log n) after the first call; see that property for keeping the cache current.
+ 
+ @author DJS 2013-02.
+ @version DJS 2026-10: Changed to get the row heights without creating a view for each row, optionally via a cache, and to support cell-based table views.
+*/
+
+- (CGFloat)dejal_contentHeight;
+{
+    return [self dejal_contentHeightUpToRow:[self numberOfRows]];
+}
+
+/**
+ Returns the height of the rows before the specified row, including the intercell spacing, i.e. the vertical offset of that row.  O(log n) once the row heights are cached, if dejal_cachesRowHeights is enabled, otherwise O(n).
+ 
+ @author DJS 2026-10.
+*/
+
+- (CGFloat)dejal_contentHeightUpToRow:(NSInteger)row;
+{
+    DejalRowHeightCache *cache = [self dejal_rowHeightCache];
+    
+    if (!cache)
+    {
+        NSUInteger clampedRow = MIN((NSUInteger)MAX(row, 0), (NSUInteger)[self numberOfRows]);
+        CGFloat height = 0.0;
+        
+        for (NSUInteger i = 0; i < clampedRow; i++)
+            height += [self dejal_heightOfRow:i];
+        
+        return height + (clampedRow * self.intercellSpacing.height);
+    }
+    
+    NSUInteger clampedRow = MIN((NSUInteger)MAX(row, 0), cache.count);
+    
+    return [cache heightUpToRow:clampedRow] + (clampedRow * self.intercellSpacing.height);
+}
+
+/**
+ Updates the cached heights of the rows with the specified indexes, e.g. after calling -noteHeightOfRowsWithIndexesChanged: or reloading those rows.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_invalidateContentHeightForRowIndexes:(NSIndexSet *)indexes;
+{
+    DejalRowHeightCache *cache = objc_getAssociatedObject(self, @selector(dejal_rowHeightCache));
+    
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger row, BOOL *stop)
+     {
+         [cache setHeight:[self dejal_heightOfRow:row] forRow:row];
+     }];
+}
+
+/**
+ Updates the cached row heights after inserting rows at the specified indexes, e.g. via -insertRowsAtIndexes:withAnimation:.  Only the heights of the new rows are requested.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_invalidateContentHeightForInsertedRowIndexes:(NSIndexSet *)indexes;
+{
+    DejalRowHeightCache *cache = objc_getAssociatedObject(self, @selector(dejal_rowHeightCache));
+    
+    // If the cache was already rebuilt for the new rows (or is out of step), there's nothing to adjust:
+    if (!cache || cache.count + indexes.count != (NSUInteger)[self numberOfRows])
+        return;
+    
+    [cache insertRowsAtIndexes:indexes heightForRow:^CGFloat(NSUInteger row)
+     {
+         return [self dejal_heightOfRow:row];
+     }];
+}
+
+/**
+ Updates the cached row heights after removing rows at the specified indexes, e.g. via -removeRowsAtIndexes:withAnimation:.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_invalidateContentHeightForRemovedRowIndexes:(NSIndexSet *)indexes;
+{
+    DejalRowHeightCache *cache = objc_getAssociatedObject(self, @selector(dejal_rowHeightCache));
+    
+    // If the cache was already rebuilt without the rows (or is out of step), there's nothing to adjust:
+    if (!cache || cache.count != [self numberOfRows] + indexes.count)
+        return;
+    
+    [cache removeRowsAtIndexes:indexes];
+}
+
+/**
+ Discards all cached row heights, e.g. after calling -reloadData.  They will be recalculated the next time they are needed.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_invalidateContentHeight;
+{
+    objc_setAssociatedObject(self, @selector(dejal_rowHeightCache), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
+
+
+/**
+ Private helper that assembles RTF from attributed string fragments, writing the body straight into byte buffers.  Fonts and colors are collected into tables as they are encountered, so the header can only be generated once all of the fragments have been appended.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalTableViewRTFWriter : NSObject
+
+@property (nonatomic, strong) NSFont *defaultFont;
+@property (nonatomic, strong) NSMutableDictionary *fontIndexes;
+@property (nonatomic, strong) NSMutableArray *fontNames;
+@property (nonatomic, strong) NSMutableDictionary *colorIndexes;
+@property (nonatomic, strong) NSMutableArray *colorEntries;
+@property (nonatomic) NSInteger currentFont;
+@property (nonatomic) NSInteger currentFontSize;
+@property (nonatomic) NSInteger currentColor;
+@property (nonatomic) BOOL currentUnderline;
+
+- (instancetype)initWithDefaultFont:(NSFont *)defaultFont;
+
+- (void)appendAttributedString:(NSAttributedString *)string toData:(NSMutableData *)data;
+- (void)appendParagraphToData:(NSMutableData *)data;
+
+- (NSData *)headerData;
+- (NSData *)trailerData;
+
+@end
+
+
+@implementation DejalTableViewRTFWriter
+
+- (instancetype)initWithDefaultFont:(NSFont *)defaultFont;
+{
+    if ((self = [super init]))
+    {
+        self.defaultFont = defaultFont ?: [NSFont systemFontOfSize:0.0];
+        self.fontIndexes = [NSMutableDictionary dictionary];
+        self.fontNames = [NSMutableArray array];
+        self.colorIndexes = [NSMutableDictionary dictionary];
+        self.colorEntries = [NSMutableArray array];
+        self.currentFont = -1;
+        self.currentFontSize = -1;
+        self.currentColor = -1;
+    }
+    
+    return self;
+}
+
+- (NSInteger)indexForFont:(NSFont *)font;
+{
+    NSString *name = font.fontName;
+    NSNumber *index = self.fontIndexes[name];
+    
+    if (!index)
+    {
+        index = @(self.fontNames.count);
+        self.fontIndexes[name] = index;
+        [self.fontNames addObject:name];
+    }
+    
+    return index.integerValue;
+}
+
+/**
+ Returns the color table index for the color, or 0 (the default color) if it is nil or can't be converted to RGB.
+*/
+
+- (NSInteger)indexForColor:(NSColor *)color;
+{
+    NSColor *rgbColor = [color colorUsingColorSpace:[NSColorSpace sRGBColorSpace]];
+    
+    if (!rgbColor)
+        return 0;
+    
+    NSString *entry = [NSString stringWithFormat:@"\\red%ld\\green%ld\\blue%ld;", (long)lround(rgbColor.redComponent * 255.0), (long)lround(rgbColor.greenComponent * 255.0), (long)lround(rgbColor.blueComponent * 255.0)];
+    NSNumber *index = self.colorIndexes[entry];
+    
+    if (!index)
+    {
+        // Index 0 is the implicit default color, so real entries start at 1:
+        index = @(self.colorEntries.count + 1);
+        self.colorIndexes[entry] = index;
+        [self.colorEntries addObject:entry];
+    }
+    
+    return index.integerValue;
+}
+
+/**
+ Appends the control words needed to switch to the attributes of a run, only emitting those that differ from the current state.
+*/
+
+- (void)appendAttributes:(NSDictionary *)attributes toData:(NSMutableData *)data;
+{
+    NSFont *font = attributes[NSFontAttributeName] ?: self.defaultFont;
+    NSInteger fontIndex = [self indexForFont:font];
+    NSInteger fontSize = lround(font.pointSize * 2.0);
+    NSInteger color = [self indexForColor:attributes[NSForegroundColorAttributeName]];
+    BOOL underline = [attributes[NSUnderlineStyleAttributeName] integerValue] != NSUnderlineStyleNone;
+    NSMutableString *controls = [NSMutableString string];
+    
+    if (fontIndex != self.currentFont)
+        [controls appendFormat:@"\\f%ld", (long)fontIndex];
+    
+    if (fontSize != self.currentFontSize)
+        [controls appendFormat:@"\\fs%ld", (long)fontSize];
+    
+    if (color != self.currentColor)
+        [controls appendFormat:@"\\cf%ld", (long)color];
+    
+    if (underline != self.currentUnderline)
+        [controls appendString:underline ? @"\\ul" : @"\\ulnone"];
+    
+    if (controls.length)
+    {
+        [controls appendString:@" "];
+        [data appendData:[controls dataUsingEncoding:NSASCIIStringEncoding]];
+    }
+    
+    self.currentFont = fontIndex;
+    self.currentFontSize = fontSize;
+    self.currentColor = color;
+    self.currentUnderline = underline;
+}
+
+/**
+ Appends the characters in the range of the string, escaped for RTF.  Non-ASCII characters are written as \u control words, one per UTF-16 unit.
+*/
+
+- (void)appendCharactersOfString:(NSString *)string range:(NSRange)range toData:(NSMutableData *)data;
+{
+    unichar characters[256];
+    char escape[16];
+    
+    while (range.length)
+    {
+        NSUInteger count = MIN(range.length, sizeof(characters) / sizeof(unichar));
+        
+        [string getCharacters:characters range:NSMakeRange(range.location, count)];
+        
+        for (NSUInteger i = 0; i < count; i++)
+        {
+            unichar c = characters[i];
+            
+            if (c == '\\' || c == '{' || c == '}')
+            {
+                char escaped[2] = {'\\', (char)c};
+                
+                [data appendBytes:escaped length:2];
+            }
+            else if (c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029)
+                [data appendBytes:"\\par\n" length:5];
+            else if (c == '\t')
+                [data appendBytes:"\\tab " length:5];
+            else if (c < 0x80)
+            {
+                char plain = (char)c;
+                
+                [data appendBytes:&plain length:1];
+            }
+            else
+            {
+                int length = snprintf(escape, sizeof(escape), "\\u%d?", (int)(short)c);
+                
+                [data appendBytes:escape length:length];
+            }
+        }
+        
+        range.location += count;
+        range.length -= count;
+    }
+}
+
+- (void)appendAttributedString:(NSAttributedString *)string toData:(NSMutableData *)data;
+{
+    NSString *characters = string.string;
+    
+    [string enumerateAttributesInRange:NSMakeRange(0, string.length) options:0 usingBlock:^(NSDictionary *attributes, NSRange range, BOOL *stop)
+     {
+         [self appendAttributes:attributes toData:data];
+         [self appendCharactersOfString:characters range:range toData:data];
+     }];
+}
+
+- (void)appendParagraphToData:(NSMutableData *)data;
+{
+    [data appendBytes:"\\par\n" length:5];
+}
+
+- (NSData *)headerData;
+{
+    NSMutableString *header = [NSMutableString stringWithString:@"{\\rtf1\\ansi\\ansicpg1252\\uc1\\deff0\n{\\fonttbl"];
+    
+    // Ensure there is always at least the default font:
+    if (!self.fontNames.count)
+        [self indexForFont:self.defaultFont];
+    
+    [self.fontNames enumerateObjectsUsingBlock:^(NSString *name, NSUInteger idx, BOOL *stop)
+     {
+         [header appendFormat:@"\\f%lu\\fnil\\fcharset0 %@;", (unsigned long)idx, name];
+     }];
+    
+    [header appendString:@"}\n{\\colortbl;"];
+    
+    for (NSString *entry in self.colorEntries)
+        [header appendString:entry];
+    
+    [header appendString:@"}\n"];
+    
+    return [header dataUsingEncoding:NSASCIIStringEncoding allowLossyConversion:YES];
+}
+
+- (NSData *)trailerData;
+{
+    return [@"}\n" dataUsingEncoding:NSASCIIStringEncoding];
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
+
+
+/**
+ Private pasteboard data provider for copied table rows.  The plain text or RTF is only encoded (in batches) when a type is actually requested, e.g. on paste, and only for that type, so copying doesn't build the whole document up front, nor hold both editions at once.  Keeps the table view until the pasteboard is finished with it.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalTableViewPasteboardProvider : NSObject <NSPasteboardItemDataProvider>
+
+@property (nonatomic, strong) NSTableView *tableView;
+@property (nonatomic, copy) NSIndexSet *indexes;
+
+@end
+
+
+@implementation DejalTableViewPasteboardProvider
+
+- (void)pasteboard:(NSPasteboard *)pasteboard item:(NSPasteboardItem *)item provideDataForType:(NSString *)type;
+{
+    NSTableView *tableView = self.tableView;
+    NSMutableIndexSet *indexes = [self.indexes mutableCopy];
+    
+    // Rows may have been removed since the copy:
+    [indexes removeIndexesInRange:NSMakeRange(tableView.numberOfRows, NSNotFound - tableView.numberOfRows)];
+    
+    if ([type isEqualToString:NSPasteboardTypeRTF])
+        [item setData:[tableView dejal_richTextDataForIndexes:indexes] forType:type];
+    else if ([type isEqualToString:NSPasteboardTypeString])
+        [item setData:[tableView dejal_plainTextDataForIndexes:indexes] forType:type];
+}
+
+- (void)pasteboardFinishedWithDataProvider:(NSPasteboard *)pasteboard;
+{
+    NSTableView *tableView = self.tableView;
+    
+    if (objc_getAssociatedObject(tableView, @selector(dejal_doLazyCopyIndexes:)) == self)
+        objc_setAssociatedObject(tableView, @selector(dejal_doLazyCopyIndexes:), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    self.tableView = nil;
 }
 
 @end
@@ -666,37 +1564,281 @@
 
 @implementation NSTableView (DejalTableViewCutCopyPasteDeleteDelegate)
 
-- (NSString *)dejal_stringForIndexes:(NSIndexSet *)indexes;
+/**
+ Appends the UTF-8 representation of the string to the data, encoding directly into the data's storage rather than via an intermediate C string or data object.
+ 
+ @author DJS 2026-10.
+*/
+
+static void DejalAppendUTF8StringToData(NSString *string, NSMutableData *data)
 {
-    NSMutableString *output = [NSMutableString string];
+    NSUInteger maxLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    NSUInteger oldLength = data.length;
+    NSUInteger usedLength = 0;
     
-    [indexes enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL *stop)
+    [data increaseLengthBy:maxLength];
+    [string getBytes:(char *)data.mutableBytes + oldLength maxLength:maxLength usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:NULL];
+    [data setLength:oldLength + usedLength];
+}
+
+/**
+ Moves the temporary file to the destination URL, atomically replacing the destination if it already exists, or simply moving it there if not (since replacing requires an existing item).
+ 
+ @author DJS 2026-10.
+*/
+
+static BOOL DejalMoveTemporaryFileToURL(NSURL *tempURL, NSURL *url, NSError **error)
+{
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    
+    if ([url checkResourceIsReachableAndReturnError:NULL])
+        return [fileManager replaceItemAtURL:url withItemAtURL:tempURL backupItemName:nil options:0 resultingItemURL:NULL error:error];
+    else
+        return [fileManager moveItemAtURL:tempURL toURL:url error:error];
+}
+
+/**
+ Returns the string values of the rows with the specified indexes, in index order, using the batched delegate method if implemented, otherwise the per-row one.  Rows without a value are represented by empty strings.  The delegate is passed in rather than fetched, so this can be called from a background queue when the delegate declares that its string values are thread-safe.
+ 
+ @author DJS 2026-10.
+*/
+
+static NSArray *DejalStringValuesForRowIndexes(NSTableView *tableView, id <DejalTableViewDelegate> delegate, NSIndexSet *indexes)
+{
+    if ([delegate respondsToSelector:@selector(tableView:stringValuesForRowIndexes:)])
+        return [delegate tableView:tableView stringValuesForRowIndexes:indexes];
+    
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:indexes.count];
+    BOOL hasValues = [delegate respondsToSelector:@selector(tableView:stringValueForRow:)];
+    
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger row, BOOL *stop)
      {
-         NSString *value = [self dejal_stringValueForRow:idx];
+         NSString *value = hasValues ? [delegate tableView:tableView stringValueForRow:row] : nil;
          
-         if (value.length)
+         [values addObject:value ?: @""];
+     }];
+    
+    return values;
+}
+
+/**
+ Returns UTF-8 data for the string values of the rows with the specified indexes, one row per line, skipping rows without a value.
+ 
+ @author DJS 2026-10.
+*/
+
+static NSData *DejalPlainTextDataForRowIndexes(NSTableView *tableView, id <DejalTableViewDelegate> delegate, NSIndexSet *indexes)
+{
+    NSMutableData *data = [NSMutableData data];
+    
+    for (NSString *value in DejalStringValuesForRowIndexes(tableView, delegate, indexes))
+    {
+        if ([value isKindOfClass:[NSString class]] && value.length)
+        {
+            DejalAppendUTF8StringToData(value, data);
+            [data appendBytes:"\n" length:1];
+        }
+    }
+    
+    return data;
+}
+
+/**
+ Pulls the string values of the rows with the specified indexes from the delegate in batches of the specified size (or 1000 rows if zero is passed), encodes each batch as UTF-8 text with one row per line, and passes the encoded data to the block, in order, along with the number of rows processed so far and the total.  The data is only valid for the duration of the block, so should be written out or copied; the whole document is never built in memory.  Set the stop parameter to YES to cancel.  Returns YES if all of the rows were processed, or NO if cancelled.
+ 
+ If the delegate implements -tableView:stringValuesForRowIndexes:, it is asked for a whole batch at a time.  If it also returns YES from -tableViewStringValuesAreThreadSafe:, up to one batch per processor core is fetched and encoded concurrently on a background queue; the block is still always invoked on the calling thread.
+ 
+ @author DJS 2026-10.
+ @version DJS 2026-10: Changed to support batched and concurrent string values.
+*/
+
+- (BOOL)dejal_enumeratePlainTextDataForIndexes:(NSIndexSet *)indexes batchSize:(NSUInteger)batchSize usingBlock:(void (^)(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop))block;
+{
+    if (!batchSize)
+        batchSize = 1000;
+    
+    id <DejalTableViewDelegate> delegate = [self dejal_delegate];
+    BOOL concurrent = [delegate respondsToSelector:@selector(tableView:stringValuesForRowIndexes:)] && [delegate respondsToSelector:@selector(tableViewStringValuesAreThreadSafe:)] && [delegate tableViewStringValuesAreThreadSafe:self];
+    NSUInteger windowSize = concurrent ? MAX([NSProcessInfo processInfo].activeProcessorCount, 1) : 1;
+    NSUInteger totalRows = indexes.count;
+    NSUInteger rowsDone = 0;
+    NSRange remainingRange = totalRows ? NSMakeRange(indexes.firstIndex, indexes.lastIndex - indexes.firstIndex + 1) : NSMakeRange(0, 0);
+    NSUInteger *rows = malloc(batchSize * sizeof(NSUInteger));
+    BOOL stop = NO;
+    
+    while (rowsDone < totalRows && !stop)
+    {
+        @autoreleasepool
+        {
+            // Gather the next window of batches, coalescing runs of consecutive rows into ranges:
+            NSMutableArray *batches = [NSMutableArray arrayWithCapacity:windowSize];
+            
+            while (batches.count < windowSize)
+            {
+                NSUInteger count = [indexes getIndexes:rows maxCount:batchSize inIndexRange:&remainingRange];
+                
+                if (!count)
+                    break;
+                
+                NSMutableIndexSet *batch = [NSMutableIndexSet indexSet];
+                NSUInteger runStart = 0;
+                
+                for (NSUInteger i = 1; i <= count; i++)
+                {
+                    if (i == count || rows[i] != rows[i - 1] + 1)
+                    {
+                        [batch addIndexesInRange:NSMakeRange(rows[runStart], rows[i - 1] - rows[runStart] + 1)];
+                        runStart = i;
+                    }
+                }
+                
+                [batches addObject:batch];
+            }
+            
+            if (!batches.count)
+                break;
+            
+            // Fetch and encode the batches, concurrently if the delegate allows:
+            NSMutableArray *results = [NSMutableArray arrayWithCapacity:batches.count];
+            
+            if (batches.count > 1)
+            {
+                for (NSUInteger i = 0; i < batches.count; i++)
+                    [results addObject:[NSNull null]];
+                
+                dispatch_apply(batches.count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i)
+                               {
+                                   @autoreleasepool
+                                   {
+                                       NSData *data = DejalPlainTextDataForRowIndexes(self, delegate, batches[i]);
+                                       
+                                       @synchronized (results)
+                                       {
+                                           results[i] = data;
+                                       }
+                                   }
+                               });
+            }
+            else
+            {
+                [results addObject:DejalPlainTextDataForRowIndexes(self, delegate, batches.firstObject)];
+            }
+            
+            // Hand the results over in order:
+            for (NSUInteger i = 0; i < batches.count && !stop; i++)
+            {
+                rowsDone += [batches[i] count];
+                block(results[i], rowsDone, totalRows, &stop);
+            }
+        }
+    }
+    
+    free(rows);
+    
+    return !stop;
+}
+
+/**
+ Writes the string values of the rows with the specified indexes to the file handle as UTF-8 text, one row per line, in batches.  If a progress handler is provided, it is invoked after each batch with the number of rows written so far and the total; return NO from it to cancel.  Returns YES if all of the rows were written, or NO if cancelled or the write failed.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_writePlainTextForIndexes:(NSIndexSet *)indexes toFileHandle:(NSFileHandle *)fileHandle progressHandler:(BOOL (^)(NSUInteger rowsDone, NSUInteger totalRows))progressHandler;
+{
+    __block BOOL failed = NO;
+    
+    BOOL finished = [self dejal_enumeratePlainTextDataForIndexes:indexes batchSize:0 usingBlock:^(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop)
+     {
+         @try
          {
-             [output appendString:value];
-             [output appendString:@"\n"];
+             [fileHandle writeData:data];
          }
+         @catch (NSException *exception)
+         {
+             failed = YES;
+             *stop = YES;
+             return;
+         }
+         
+         if (progressHandler && !progressHandler(rowsDone, totalRows))
+             *stop = YES;
+     }];
+    
+    return finished && !failed;
+}
+
+/**
+ Returns UTF-8 plain text data for the rows with the specified indexes, one row per line.  The rows are encoded directly into the data, without building an intermediate string.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSData *)dejal_plainTextDataForIndexes:(NSIndexSet *)indexes;
+{
+    NSMutableData *output = [NSMutableData data];
+    
+    [self dejal_enumeratePlainTextDataForIndexes:indexes batchSize:0 usingBlock:^(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop)
+     {
+         [output appendData:data];
      }];
     
     return output;
 }
 
+/**
+ Copies the string values of the rows with the specified indexes to the general pasteboard.  The data is built immediately, since it needs to be complete before the rows can be deleted, e.g. for Cut; see -dejal_doLazyCopyIndexes: for Copy.
+ 
+ @author DJS 2004-12.
+ @version DJS 2026-10: Changed to encode the rows directly into the pasteboard data, instead of via one large string.
+ @version DJS 2026-10: Changed to also copy rich text if the delegate provides attributed string values.
+*/
+
 - (BOOL)dejal_doCopyIndexes:(NSIndexSet *)indexes;
 {
-    // Convert the constructed output attributed string to RTFD and a plain string:
     NSPasteboard *pboard = [NSPasteboard generalPasteboard];
-    NSString *plainString = [self dejal_stringForIndexes:indexes];
+    NSData *plainData = [self dejal_plainTextDataForIndexes:indexes];
+    BOOL includeRichText = [[self dejal_delegate] respondsToSelector:@selector(tableView:attributedStringValueForRow:)];
     
     // Declare types:
-    [pboard declareTypes:@[NSPasteboardTypeString] owner:self];
+    if (includeRichText)
+        [pboard declareTypes:@[NSPasteboardTypeRTF, NSPasteboardTypeString] owner:self];
+    else
+        [pboard declareTypes:@[NSPasteboardTypeString] owner:self];
     
     // Copy values to pasteboard:
-    [pboard setString:plainString forType:NSPasteboardTypeString];
+    if (includeRichText && ![pboard setData:[self dejal_richTextDataForIndexes:indexes] forType:NSPasteboardTypeRTF])
+        return NO;
     
-    return YES;
+    return [pboard setData:plainData forType:NSPasteboardTypeString];
+}
+
+/**
+ Copies the rows with the specified indexes to the general pasteboard, like -dejal_doCopyIndexes:, but via a data provider, so the plain text or RTF is only encoded in batches when a paste (or the app quitting) asks for it, and only in the requested format.  The rows are read at that time, so reflect any changes to their values since the copy.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_doLazyCopyIndexes:(NSIndexSet *)indexes;
+{
+    NSPasteboard *pboard = [NSPasteboard generalPasteboard];
+    BOOL includeRichText = [[self dejal_delegate] respondsToSelector:@selector(tableView:attributedStringValueForRow:)];
+    NSArray *types = includeRichText ? @[NSPasteboardTypeRTF, NSPasteboardTypeString] : @[NSPasteboardTypeString];
+    DejalTableViewPasteboardProvider *provider = [DejalTableViewPasteboardProvider new];
+    NSPasteboardItem *item = [NSPasteboardItem new];
+    
+    provider.tableView = self;
+    provider.indexes = indexes;
+    
+    if (![item setDataProvider:provider forTypes:types])
+        return NO;
+    
+    // Keep the provider until the pasteboard is finished with it:
+    objc_setAssociatedObject(self, @selector(dejal_doLazyCopyIndexes:), provider, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    [pboard clearContents];
+    
+    return [pboard writeObjects:@[item]];
 }
 
 - (IBAction)cut:(id)sender
@@ -718,7 +1860,7 @@
     if (!indexes)
         return;
     
-    [self dejal_doCopyIndexes:indexes];
+    [self dejal_doLazyCopyIndexes:indexes];
 }
 
 - (IBAction)paste:(id)sender
@@ -728,7 +1870,7 @@
     if (row < 0)
         return;
     
-    NSLog(@"The -paste: method for table views is not implemented yet!");		//  log
+    [self dejal_pasteFromPasteboard:[NSPasteboard generalPasteboard] beforeRow:row];
 }
 
 - (IBAction)delete:(id)sender
@@ -741,28 +1883,238 @@
     }
 }
 
+/**
+ Saves the string values of the rows to save (as determined by -dejal_shouldSaveRowIndexes) to the specified file URL as UTF-8 plain text.
+ 
+ @author DJS 2010-05.
+ @version DJS 2026-10: Changed to stream the rows to disk in batches.
+*/
+
 - (BOOL)dejal_savePlainTextToURL:(NSURL *)url;
+{
+    return [self dejal_savePlainTextToURL:url progressHandler:nil error:NULL];
+}
+
+/**
+ Saves the string values of the rows to save (as determined by -dejal_shouldSaveRowIndexes) to the specified file URL as UTF-8 plain text.  The rows are pulled from the delegate and written in batches to a temporary file, which then atomically replaces the destination (or is moved there, if there's no existing file), so the whole document is never held in memory.  If a progress handler is provided, it is invoked after each batch with the number of rows written so far and the total; return NO from it to cancel, leaving any existing file untouched.  Returns YES if the file was saved, otherwise NO with the error set, if provided (NSUserCancelledError if cancelled).
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_savePlainTextToURL:(NSURL *)url progressHandler:(BOOL (^)(NSUInteger rowsDone, NSUInteger totalRows))progressHandler error:(NSError **)error;
 {
     NSIndexSet *indexes = [self dejal_shouldSaveRowIndexes];
     
-    if (!indexes)
+    if (!indexes || !url.isFileURL)
+    {
+        if (error)
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteInvalidFileNameError userInfo:url ? @{NSURLErrorKey : url} : nil];
+        
         return NO;
+    }
+    
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *tempURL = [[url URLByDeletingLastPathComponent] URLByAppendingPathComponent:[NSString stringWithFormat:@".%@.%@", url.lastPathComponent, [NSUUID UUID].UUIDString]];
+    
+    if (![fileManager createFileAtPath:tempURL.path contents:nil attributes:nil])
+    {
+        if (error)
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{NSURLErrorKey : tempURL}];
+        
+        return NO;
+    }
+    
+    NSFileHandle *fileHandle = [NSFileHandle fileHandleForWritingToURL:tempURL error:error];
+    BOOL saved = NO;
+    
+    if (fileHandle)
+    {
+        __block BOOL cancelled = NO;
+        
+        saved = [self dejal_writePlainTextForIndexes:indexes toFileHandle:fileHandle progressHandler:^BOOL(NSUInteger rowsDone, NSUInteger totalRows)
+                 {
+                     cancelled = progressHandler && !progressHandler(rowsDone, totalRows);
+                     
+                     return !cancelled;
+                 }];
+        
+        if (!saved && error)
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:cancelled ? NSUserCancelledError : NSFileWriteUnknownError userInfo:@{NSURLErrorKey : url}];
+    }
+    
+    [fileHandle closeFile];
+    
+    if (saved)
+        saved = DejalMoveTemporaryFileToURL(tempURL, url, error);
+    
+    if (!saved)
+        [fileManager removeItemAtURL:tempURL error:NULL];
+    
+    return saved;
+}
+
+/**
+ Pulls the attributed string values of the rows with the specified indexes in batches, and converts each batch to the body of an RTF document using the writer, passing the resulting data to the block along with the number of rows processed so far and the total.  The data is only valid for the duration of the block.  Set the stop parameter to YES to cancel.  Returns YES if all of the rows were processed, or NO if cancelled.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_enumerateRichTextBodyDataForIndexes:(NSIndexSet *)indexes writer:(DejalTableViewRTFWriter *)writer usingBlock:(void (^)(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop))block;
+{
+    NSUInteger totalRows = indexes.count;
+    NSUInteger rowsDone = 0;
+    NSUInteger row = indexes.firstIndex;
+    NSMutableData *buffer = [NSMutableData data];
+    BOOL stop = NO;
     
-    NSString *plainString = [self dejal_stringForIndexes:indexes];
+    while (row != NSNotFound && !stop)
+    {
+        @autoreleasepool
+        {
+            [buffer setLength:0];
+            
+            for (NSUInteger i = 0; i < 1000 && row != NSNotFound; i++)
+            {
+                NSAttributedString *value = [self dejal_attributedStringValueForRow:row];
+                
+                if (value.length)
+                {
+                    [writer appendAttributedString:value toData:buffer];
+                    [writer appendParagraphToData:buffer];
+                }
+                
+                rowsDone++;
+                row = [indexes indexGreaterThanIndex:row];
+            }
+            
+            block(buffer, rowsDone, totalRows, &stop);
+        }
+    }
     
-    return [plainString writeToURL:url atomically:YES encoding:NSUTF8StringEncoding error:NULL];
+    return !stop;
+}
+
+/**
+ Returns RTF data for the rows with the specified indexes, one row per paragraph.  The RTF is written directly from each row's attributed string, rather than by concatenating attributed strings.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSData *)dejal_richTextDataForIndexes:(NSIndexSet *)indexes;
+{
+    DejalTableViewRTFWriter *writer = [[DejalTableViewRTFWriter alloc] initWithDefaultFont:self.font];
+    NSMutableData *body = [NSMutableData data];
+    
+    [self dejal_enumerateRichTextBodyDataForIndexes:indexes writer:writer usingBlock:^(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop)
+     {
+         [body appendData:data];
+     }];
+    
+    NSMutableData *output = [NSMutableData dataWithData:[writer headerData]];
+    
+    [output appendData:body];
+    [output appendData:[writer trailerData]];
+    
+    return output;
 }
 
+/**
+ Saves the attributed string values of the rows to save (as determined by -dejal_shouldSaveRowIndexes) to the specified file URL as RTF.
+ 
+ @author DJS 2010-05.
+ @version DJS 2026-10: Implemented, streaming the rows to disk in batches.
+*/
+
 - (BOOL)dejal_saveRichTextToURL:(NSURL *)url;
+{
+    return [self dejal_saveRichTextToURL:url progressHandler:nil error:NULL];
+}
+
+/**
+ Saves the attributed string values of the rows to save (as determined by -dejal_shouldSaveRowIndexes) to the specified file URL as RTF, one row per paragraph.  Since the RTF font and color tables must precede the text, the body is first streamed in batches to a temporary file, then copied in chunks after the header into another temporary file, which atomically replaces the destination (or is moved there, if there's no existing file).  If a progress handler is provided, it is invoked after each batch with the number of rows written so far and the total; return NO from it to cancel, leaving any existing file untouched.  Returns YES if the file was saved, otherwise NO with the error set, if provided (NSUserCancelledError if cancelled).
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_saveRichTextToURL:(NSURL *)url progressHandler:(BOOL (^)(NSUInteger rowsDone, NSUInteger totalRows))progressHandler error:(NSError **)error;
 {
     NSIndexSet *indexes = [self dejal_shouldSaveRowIndexes];
     
-    if (!indexes)
+    if (!indexes || !url.isFileURL)
+    {
+        if (error)
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteInvalidFileNameError userInfo:url ? @{NSURLErrorKey : url} : nil];
+        
         return NO;
+    }
+    
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    NSURL *folderURL = [url URLByDeletingLastPathComponent];
+    NSString *uniqueName = [NSUUID UUID].UUIDString;
+    NSURL *bodyURL = [folderURL URLByAppendingPathComponent:[NSString stringWithFormat:@".%@.%@.body", url.lastPathComponent, uniqueName]];
+    NSURL *tempURL = [folderURL URLByAppendingPathComponent:[NSString stringWithFormat:@".%@.%@", url.lastPathComponent, uniqueName]];
+    DejalTableViewRTFWriter *writer = [[DejalTableViewRTFWriter alloc] initWithDefaultFont:self.font];
+    __block BOOL saved = NO;
+    __block BOOL cancelled = NO;
+    
+    if ([fileManager createFileAtPath:bodyURL.path contents:nil attributes:nil] && [fileManager createFileAtPath:tempURL.path contents:nil attributes:nil])
+    {
+        NSFileHandle *bodyHandle = [NSFileHandle fileHandleForUpdatingURL:bodyURL error:NULL];
+        NSFileHandle *outputHandle = [NSFileHandle fileHandleForWritingToURL:tempURL error:NULL];
+        
+        @try
+        {
+            saved = bodyHandle && outputHandle && [self dejal_enumerateRichTextBodyDataForIndexes:indexes writer:writer usingBlock:^(NSData *data, NSUInteger rowsDone, NSUInteger totalRows, BOOL *stop)
+                     {
+                         [bodyHandle writeData:data];
+                         
+                         if (progressHandler && !progressHandler(rowsDone, totalRows))
+                         {
+                             cancelled = YES;
+                             *stop = YES;
+                         }
+                     }];
+            
+            if (saved)
+            {
+                [outputHandle writeData:[writer headerData]];
+                [bodyHandle seekToFileOffset:0];
+                
+                NSData *chunk = nil;
+                
+                do
+                {
+                    @autoreleasepool
+                    {
+                        chunk = [bodyHandle readDataOfLength:1024 * 1024];
+                        [outputHandle writeData:chunk];
+                    }
+                }
+                while (chunk.length);
+                
+                [outputHandle writeData:[writer trailerData]];
+            }
+        }
+        @catch (NSException *exception)
+        {
+            saved = NO;
+        }
+        
+        [bodyHandle closeFile];
+        [outputHandle closeFile];
+    }
     
-    NSLog(@"-saveRichTextToURL: does not work yet!");         // log
+    if (saved)
+        saved = DejalMoveTemporaryFileToURL(tempURL, url, error);
+    else if (error)
+        *error = [NSError errorWithDomain:NSCocoaErrorDomain code:cancelled ? NSUserCancelledError : NSFileWriteUnknownError userInfo:@{NSURLErrorKey : url}];
     
-    return NO;
+    if (!saved)
+        [fileManager removeItemAtURL:tempURL error:NULL];
+    
+    [fileManager removeItemAtURL:bodyURL error:NULL];
+    
+    return saved;
 }
 
 - (BOOL)validateMenuItem:(NSMenuItem *)item;
@@ -914,5 +2266,46 @@
         return nil;
 }
 
+/**
+ Returns the string values of the rows with the specified indexes, in index order.  If the delegate responds to -tableView:stringValuesForRowIndexes:, it is invoked once for all of the rows; otherwise -tableView:stringValueForRow: is invoked for each row.  Rows without a value are represented by empty strings.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSArray *)dejal_stringValuesForRowIndexes:(NSIndexSet *)indexes;
+{
+    return DejalStringValuesForRowIndexes(self, [self dejal_delegate], indexes);
+}
+
+/**
+ If the delegate responds to -tableView:attributedStringValueForRow:, it is invoked with the specified row.  The delegate should return a styled string representation of the specified row.  Otherwise the plain string value of the row is returned without attributes (so it will use the table's font when saved as rich text).
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSAttributedString *)dejal_attributedStringValueForRow:(NSUInteger)row;
+{
+    if ([[self dejal_delegate] respondsToSelector:@selector(tableView:attributedStringValueForRow:)])
+        return [[self dejal_delegate] tableView:self attributedStringValueForRow:row];
+    
+    NSString *value = [self dejal_stringValueForRow:row];
+    
+    return value ? [[NSAttributedString alloc] initWithString:value] : nil;
+}
+
+/**
+ If the delegate responds to -tableView:pasteFromPasteboard:beforeRow:, it is invoked with the pasteboard and the row to paste before (as returned by -dejal_shouldPasteBeforeRow).  The delegate should read the data it supports from the pasteboard and insert the corresponding rows into its data source, returning YES if it did so.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_pasteFromPasteboard:(NSPasteboard *)pboard beforeRow:(NSInteger)row;
+{
+    if (row >= 0 && [[self dejal_delegate] respondsToSelector:@selector(tableView:pasteFromPasteboard:beforeRow:)])
+        return [[self dejal_delegate] tableView:self pasteFromPasteboard:pboard beforeRow:row];
+    else
+        return NO;
+}
+
 @end
 
@@ -28,7 +28,6 @@
 //
 
 #import "NSTextField+Dejal.h"
-#import "NSView+Dejal.h"
 #import "NSWindow+Dejal.h"
 
 
@@ -121,9 +120,10 @@
 }
 
 /**
- If the field content doesn't currently fit within its frame, this method resizes the window that contains this field, and the field itself, so that it does fit.  The window and field are only resized vertically.  The auto-resizing springs and struts are not needed or affected for this change.  The window size is only increased, never decreased.  Returns YES if a resize was needed, or NO if it was already big enough.
+ If the field content doesn't currently fit within its frame, this method resizes the window that contains this field, and the field itself, so that it does fit.  The window and field are only resized vertically.  The auto-resizing springs and struts are not needed or affected for this change.  The window size is only increased, never decreased.  Returns YES if a resize was needed, or NO if it was already big enough.  When several fields may need to grow, call this within NSWindow's -dejal_performResizeTransaction: to resize the window only once.
  
  @author DJS 2006-01.
+ @version DJS 2026-10: Changed to use NSWindow's -dejal_resizeView:verticallyToHeight:, so it can be coalesced in a resize transaction.
 */
 
 - (BOOL)dejal_resizeWindowVerticallyToFit;
@@ -139,14 +139,8 @@
     if (NSHeight(newFrame) <= NSHeight(oldFrame))
         return NO;
     
-    // We need to resize, so adjust the autoresize masks:
-    NSArray *masks = [self dejal_adjustAutoresizeMasks];
-    
-    // Resize the window based on the new text field frame size:
-    [[self window] dejal_setFrameSoView:self hasSize:newFrame.size centerHorizontalPostion:NO];
-    
-    // Tidy up:
-    [self dejal_restoreAutoresizeMasks:masks];
+    // Resize the window based on the new text field frame size, or defer it if in a transaction:
+    [[self window] dejal_resizeView:self verticallyToHeight:NSHeight(newFrame)];
     
     return YES;
 }
@@ -40,6 +40,11 @@
 - (NSInteger)dejal_length;
 - (NSRange)dejal_allRange;
 
+- (void)dejal_RTFValueWithCompletionHandler:(void (^)(NSData *data))completion;
+- (void)dejal_RTFDValueWithCompletionHandler:(void (^)(NSData *data))completion;
+- (void)dejal_writeRichText:(BOOL)rich toURL:(NSURL *)url completionHandler:(void (^)(BOOL success, NSError *error))completion;
+- (void)dejal_writeRichText:(BOOL)rich toStream:(NSOutputStream *)stream completionHandler:(void (^)(BOOL success, NSError *error))completion;
+
 - (void)dejal_setTypingAttributesToMatchView;
 
 - (IBAction)deselectAll:(id)sender;
@@ -53,6 +58,12 @@
 - (void)dejal_appendStringValue:(NSString *)value;
 - (void)dejal_appendAttributedStringValue:(NSAttributedString *)value;
 
+@property (nonatomic, setter=dejal_setMaximumBufferedLength:) NSUInteger dejal_maximumBufferedLength;
+
+- (void)dejal_bufferedAppendStringValue:(NSString *)value;
+- (void)dejal_bufferedAppendAttributedStringValue:(NSAttributedString *)value;
+- (void)dejal_flushBufferedAppends;
+
 
 // ----------------------------------------------------------------------------------------
 #pragma mark -
@@ -65,6 +76,9 @@
 - (NSAttributedString *)dejal_selectedAttributedStringValue;
 - (NSAttributedString *)dejal_selectedOrAllAttributedStringValue;
 
+- (void)dejal_enumerateSelectedStringValueOrAll:(BOOL)orAll chunkLength:(NSUInteger)chunkLength usingBlock:(void (^)(NSString *chunk, NSRange range, BOOL *stop))block;
+- (void)dejal_enumerateSelectedAttributedStringValueOrAll:(BOOL)orAll chunkLength:(NSUInteger)chunkLength usingBlock:(void (^)(NSString *chunk, NSDictionary *attributes, NSRange range, BOOL *stop))block;
+
 
 // ----------------------------------------------------------------------------------------
 #pragma mark -
@@ -73,5 +87,8 @@
 
 - (void)dejal_setRTFDValue:(NSData *)theRTFD orRTF:(NSData *)theRTF orAttributedString:(NSAttributedString *)attrString orString:(NSString *)string;
 
+- (void)dejal_loadRTFDValue:(NSData *)theRTFD orRTF:(NSData *)theRTF orAttributedString:(NSAttributedString *)attrString orString:(NSString *)string progressHandler:(BOOL (^)(NSUInteger charactersDone, NSUInteger totalCharacters))progressHandler completionHandler:(void (^)(BOOL finished, NSTimeInterval firstScreenfulTime))completion;
+- (void)dejal_cancelLoading;
+
 @end
 
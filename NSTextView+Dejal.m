@@ -29,6 +29,44 @@
 
 #import "NSTextView+Dejal.h"
 #import "NSAttributedString+Dejal.h"
+#import <objc/runtime.h>
+
+
+/**
+ Private buffer of text waiting to be appended to a text view, plus the cached attributes for plain appends, and the length limit.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalTextViewAppendBuffer : NSObject
+
+@property (nonatomic, strong) NSMutableAttributedString *pending;
+@property (nonatomic, copy) NSDictionary *attributes;
+@property (nonatomic) BOOL lastAppendWasPlain;
+@property (nonatomic) BOOL flushScheduled;
+@property (nonatomic) NSUInteger maximumLength;
+
+@end
+
+
+@implementation DejalTextViewAppendBuffer
+
+- (instancetype)init;
+{
+    if ((self = [super init]))
+    {
+        _pending = [NSMutableAttributedString new];
+    }
+    
+    return self;
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
 
 
 @implementation NSTextView (Dejal)
@@ -56,9 +94,10 @@
 }
 
 /**
- After changing the font or foreground/background colors of a NSTextView, call this to apply those changes to zero-length selections too (i.e. the next user typing).  Otherwise, new typing will be inserted in the old style (which can be useful sometimes).
+ After changing the font or foreground/background colors of a NSTextView, call this to apply those changes to zero-length selections too (i.e. the next user typing).  Otherwise, new typing will be inserted in the old style (which can be useful sometimes).  Also used for subsequent buffered plain appends.
  
  @author DJS 2006-10.
+ @version DJS 2026-10: Changed to reset the attributes for buffered appends.
 */
 
 - (void)dejal_setTypingAttributesToMatchView;
@@ -70,6 +109,12 @@
     attributes[NSBackgroundColorAttributeName] = [self backgroundColor];
     
     [self setTypingAttributes:attributes];
+    
+    // Buffered plain appends should use the new attributes:
+    DejalTextViewAppendBuffer *buffer = objc_getAssociatedObject(self, @selector(dejal_appendBuffer));
+    
+    buffer.attributes = nil;
+    buffer.lastAppendWasPlain = NO;
 }
 
 /**
@@ -118,12 +163,301 @@
     [[self textStorage] appendAttributedString:value];
 }
 
+/**
+ Returns the receiver's append buffer, creating it if needed.
+ 
+ @author DJS 2026-10.
+*/
+
+- (DejalTextViewAppendBuffer *)dejal_appendBuffer;
+{
+    DejalTextViewAppendBuffer *buffer = objc_getAssociatedObject(self, @selector(dejal_appendBuffer));
+    
+    if (!buffer)
+    {
+        buffer = [DejalTextViewAppendBuffer new];
+        objc_setAssociatedObject(self, @selector(dejal_appendBuffer), buffer, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    
+    return buffer;
+}
+
+/**
+ The maximum number of characters to keep in the receiver when using the buffered append methods.  When exceeded, whole lines are trimmed from the start of the text (or just the excess, if the last line alone is too long), so it acts like a ring buffer, e.g. for a log console.  Zero (the default) means no limit.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSUInteger)dejal_maximumBufferedLength;
+{
+    return [self dejal_appendBuffer].maximumLength;
+}
+
+- (void)dejal_setMaximumBufferedLength:(NSUInteger)maximumLength;
+{
+    [self dejal_appendBuffer].maximumLength = maximumLength;
+}
+
+/**
+ Appends the specified plain string to the end of the receiver, using the typing attributes.  Like the other buffered method, the string isn't added immediately, but is coalesced with other appends in the same run loop pass, so they result in a single text storage edit and layout pass.  The typing attributes are cached until -dejal_setTypingAttributesToMatchView is called, and consecutive plain appends extend the same attribute run.  Should be called on the main thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_bufferedAppendStringValue:(NSString *)value;
+{
+    if (![value length])
+        return;
+    
+    DejalTextViewAppendBuffer *buffer = [self dejal_appendBuffer];
+    
+    if (buffer.lastAppendWasPlain)
+    {
+        [[buffer.pending mutableString] appendString:value];
+    }
+    else
+    {
+        if (!buffer.attributes)
+            buffer.attributes = [self typingAttributes];
+        
+        NSAttributedString *string = [[NSAttributedString alloc] initWithString:value attributes:buffer.attributes];
+        
+        [buffer.pending appendAttributedString:string];
+        buffer.lastAppendWasPlain = YES;
+    }
+    
+    [self dejal_scheduleBufferedAppendFlush];
+}
+
+/**
+ Appends the specified attributed string to the end of the receiver, coalesced with other appends in the same run loop pass.  Should be called on the main thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_bufferedAppendAttributedStringValue:(NSAttributedString *)value;
+{
+    if (![value length])
+        return;
+    
+    DejalTextViewAppendBuffer *buffer = [self dejal_appendBuffer];
+    
+    [buffer.pending appendAttributedString:value];
+    buffer.lastAppendWasPlain = NO;
+    
+    [self dejal_scheduleBufferedAppendFlush];
+}
+
+/**
+ Schedules the buffered appends to be flushed once the current run loop pass is done, if not already scheduled.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_scheduleBufferedAppendFlush;
+{
+    DejalTextViewAppendBuffer *buffer = [self dejal_appendBuffer];
+    
+    if (buffer.flushScheduled)
+        return;
+    
+    buffer.flushScheduled = YES;
+    
+    __weak NSTextView *weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^
+    {
+        [weakSelf dejal_flushBufferedAppends];
+    });
+}
+
+/**
+ Returns the number of characters to remove from the start of the string to bring it within the maximum length.  Rounds up to the end of the line containing the excess, so whole lines are removed, unless that would remove everything (e.g. a single line longer than the maximum), in which case just the excess is removed, extended to the end of a composed character sequence so it isn't split.
+ 
+ @author DJS 2026-10.
+*/
+
+static NSUInteger DejalTrimLengthForMaximumLength(NSString *string, NSUInteger maximumLength)
+{
+    NSUInteger length = [string length];
+    
+    if (length <= maximumLength)
+        return 0;
+    
+    NSUInteger excess = length - maximumLength;
+    NSUInteger lineEnd = NSMaxRange([string lineRangeForRange:NSMakeRange(excess - 1, 0)]);
+    
+    if (lineEnd < length)
+        return lineEnd;
+    
+    return MIN(NSMaxRange([string rangeOfComposedCharacterSequenceAtIndex:excess - 1]), length);
+}
+
+/**
+ Immediately appends any buffered text to the receiver, in a single text storage edit, trimming whole lines from the start if the maximum buffered length is exceeded (or just the excess, if the remaining text is a single line).  Called automatically after the run loop pass in which text was appended, but can be called directly, e.g. before reading the text.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_flushBufferedAppends;
+{
+    DejalTextViewAppendBuffer *buffer = objc_getAssociatedObject(self, @selector(dejal_appendBuffer));
+    NSMutableAttributedString *pending = buffer.pending;
+    
+    buffer.flushScheduled = NO;
+    
+    if (![pending length])
+        return;
+    
+    buffer.pending = [NSMutableAttributedString new];
+    buffer.lastAppendWasPlain = NO;
+    
+    NSUInteger maximumLength = buffer.maximumLength;
+    
+    // If the pending text alone exceeds the limit, don't bother appending what would be trimmed:
+    if (maximumLength && [pending length] > maximumLength)
+    {
+        [pending deleteCharactersInRange:NSMakeRange(0, DejalTrimLengthForMaximumLength([pending string], maximumLength))];
+    }
+    
+    NSTextStorage *textStorage = [self textStorage];
+    
+    [textStorage beginEditing];
+    [textStorage appendAttributedString:pending];
+    
+    if (maximumLength && [textStorage length] > maximumLength)
+    {
+        [textStorage deleteCharactersInRange:NSMakeRange(0, DejalTrimLengthForMaximumLength([textStorage string], maximumLength))];
+    }
+    
+    [textStorage endEditing];
+}
+
 
 // ----------------------------------------------------------------------------------------
 #pragma mark -
 // ----------------------------------------------------------------------------------------
 
 
+/**
+ Enumerates the range of the string in pieces of at most the chunk length (or a little more, if needed to keep a composed character sequence together), ending at composed character boundaries.  Each piece is copied into the reusable buffer and wrapped in a string that doesn't copy or own it, so is only valid within the block.  Returns YES if the block stopped the enumeration.
+ 
+ @author DJS 2026-10.
+*/
+
+static BOOL DejalEnumerateStringChunks(NSString *string, NSRange range, NSUInteger chunkLength, NSMutableData *buffer, void (^block)(NSString *chunk, NSRange chunkRange, BOOL *stop))
+{
+    NSUInteger index = range.location;
+    NSUInteger rangeEnd = NSMaxRange(range);
+    BOOL stop = NO;
+    
+    while (index < rangeEnd && !stop)
+    {
+        NSUInteger end = MIN(index + chunkLength, rangeEnd);
+        
+        if (end < rangeEnd)
+        {
+            NSRange sequence = [string rangeOfComposedCharacterSequenceAtIndex:end];
+            
+            end = sequence.location > index ? sequence.location : MIN(NSMaxRange(sequence), rangeEnd);
+        }
+        
+        NSRange chunkRange = NSMakeRange(index, end - index);
+        
+        if ([buffer length] < chunkRange.length * sizeof(unichar))
+            [buffer setLength:chunkRange.length * sizeof(unichar)];
+        
+        [string getCharacters:[buffer mutableBytes] range:chunkRange];
+        
+        @autoreleasepool
+        {
+            NSString *chunk = [[NSString alloc] initWithCharactersNoCopy:[buffer mutableBytes] length:chunkRange.length freeWhenDone:NO];
+            
+            block(chunk, chunkRange, &stop);
+        }
+        
+        index = end;
+    }
+    
+    return stop;
+}
+
+/**
+ Returns the non-empty selected ranges of the receiver, or if none and orAll is YES, the range of all of the text.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSArray *)dejal_selectedRangesOrAll:(BOOL)orAll;
+{
+    NSMutableArray *ranges = [NSMutableArray array];
+    
+    for (NSValue *value in [self selectedRanges])
+    {
+        if ([value rangeValue].length)
+            [ranges addObject:value];
+    }
+    
+    if (![ranges count] && orAll && [self dejal_length])
+        [ranges addObject:[NSValue valueWithRange:[self dejal_allRange]]];
+    
+    return ranges;
+}
+
+/**
+ Enumerates the selected text (or all of it, if orAll is YES and there's no selection) in chunks of roughly the specified length (or 64K characters if zero), without building a substring of the whole selection.  The block receives each chunk and its range in the text.  The chunk string is backed by a reused buffer, so is only valid within the block; copy it to keep it.  Set stop to YES to stop the enumeration.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_enumerateSelectedStringValueOrAll:(BOOL)orAll chunkLength:(NSUInteger)chunkLength usingBlock:(void (^)(NSString *chunk, NSRange range, BOOL *stop))block;
+{
+    NSString *string = [self string];
+    NSMutableData *buffer = [NSMutableData data];
+    
+    if (!chunkLength)
+        chunkLength = 65536;
+    
+    for (NSValue *value in [self dejal_selectedRangesOrAll:orAll])
+    {
+        if (DejalEnumerateStringChunks(string, [value rangeValue], chunkLength, buffer, block))
+            break;
+    }
+}
+
+/**
+ Enumerates the selected text (or all of it, if orAll is YES and there's no selection) as attribute runs, split into chunks of roughly the specified length (or 64K characters if zero), without building an attributed substring.  The block receives each chunk, its attributes, and its range in the text.  As with the plain edition, the chunk string is only valid within the block.  Set stop to YES to stop the enumeration.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_enumerateSelectedAttributedStringValueOrAll:(BOOL)orAll chunkLength:(NSUInteger)chunkLength usingBlock:(void (^)(NSString *chunk, NSDictionary *attributes, NSRange range, BOOL *stop))block;
+{
+    NSTextStorage *textStorage = [self textStorage];
+    NSString *string = [textStorage string];
+    NSMutableData *buffer = [NSMutableData data];
+    __block BOOL stopped = NO;
+    
+    if (!chunkLength)
+        chunkLength = 65536;
+    
+    for (NSValue *value in [self dejal_selectedRangesOrAll:orAll])
+    {
+        [textStorage enumerateAttributesInRange:[value rangeValue] options:0 usingBlock:^(NSDictionary *attributes, NSRange runRange, BOOL *stopRuns)
+        {
+            stopped = DejalEnumerateStringChunks(string, runRange, chunkLength, buffer, ^(NSString *chunk, NSRange chunkRange, BOOL *stopChunks)
+            {
+                block(chunk, attributes, chunkRange, stopChunks);
+            });
+            
+            *stopRuns = stopped;
+        }];
+        
+        if (stopped)
+            break;
+    }
+}
+
 /**
  Returns an autoreleased copy of the selected text of the receiver as a plain string.
  
@@ -221,11 +555,12 @@
  
  @author DJS 2004-05.
  @version DJS 2015-09: Changed to use an empty dictionary instead of nil, to avoid a nullability warning.
+ @version DJS 2026-10: Changed to encode the text storage directly, instead of copying it first.
 */
 
 - (NSData *)dejal_RTFValue
 {
-    NSAttributedString *text = [self dejal_attributedStringValue];
+    NSTextStorage *text = [self textStorage];
     
     return [text RTFFromRange:NSMakeRange(0, [text length]) documentAttributes:@{}];
 }
@@ -235,15 +570,166 @@
  
  @author DJS 2004-05.
  @version DJS 2015-09: Changed to use an empty dictionary instead of nil, to avoid a nullability warning.
+ @version DJS 2026-10: Changed to encode the text storage directly, instead of copying it first.
 */
 
 - (NSData *)dejal_RTFDValue
 {
-    NSAttributedString *text = [self dejal_attributedStringValue];
+    NSTextStorage *text = [self textStorage];
     
     return [text RTFDFromRange:NSMakeRange(0, [text length]) documentAttributes:@{}];
 }
 
+/**
+ Returns the queue used for background serialization.
+ 
+ @author DJS 2026-10.
+*/
+
++ (dispatch_queue_t)dejal_serializationQueue;
+{
+    static dispatch_queue_t queue = nil;
+    static dispatch_once_t onceToken;
+    
+    dispatch_once(&onceToken, ^
+    {
+        queue = dispatch_queue_create("com.dejal.textview.serialization", DISPATCH_QUEUE_SERIAL);
+        dispatch_set_target_queue(queue, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+    });
+    
+    return queue;
+}
+
+/**
+ Takes an immutable snapshot of the text on the calling thread, then invokes the block with it on the background serialization queue.  Flushes any buffered appends first, so they're included.  Note that the snapshot is a full copy of the characters and attribute runs, so still takes time proportional to the length of the text on the calling thread; it is much cheaper than encoding, but for very large documents it isn't free.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_performWithTextSnapshot:(void (^)(NSAttributedString *text))block;
+{
+    [self dejal_flushBufferedAppends];
+    
+    NSAttributedString *text = [[self textStorage] copy];
+    
+    dispatch_async([NSTextView dejal_serializationQueue], ^
+    {
+        block(text);
+    });
+}
+
+/**
+ Encodes a RTF edition of the text on a background queue, then invokes the completion handler with it on the main queue.  Only a snapshot of the text is taken on the calling thread (an O(n) copy; see -dejal_performWithTextSnapshot:), so the encoding doesn't block it, and the text view can continue to be edited, e.g. when autosaving.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_RTFValueWithCompletionHandler:(void (^)(NSData *data))completion;
+{
+    [self dejal_performWithTextSnapshot:^(NSAttributedString *text)
+    {
+        NSData *data = [text RTFFromRange:NSMakeRange(0, [text length]) documentAttributes:@{}];
+        
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            completion(data);
+        });
+    }];
+}
+
+/**
+ Encodes a RTFD edition of the text on a background queue, then invokes the completion handler with it on the main queue.  See -dejal_RTFValueWithCompletionHandler:.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_RTFDValueWithCompletionHandler:(void (^)(NSData *data))completion;
+{
+    [self dejal_performWithTextSnapshot:^(NSAttributedString *text)
+    {
+        NSData *data = [text RTFDFromRange:NSMakeRange(0, [text length]) documentAttributes:@{}];
+        
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            completion(data);
+        });
+    }];
+}
+
+/**
+ Writes the text to the URL on a background queue, then invokes the completion handler, if any, on the main queue.  If rich is YES, the text is written as a RTFD package via a file wrapper, so attachments are written as files rather than being flattened into one big data object; otherwise it is written atomically as RTF.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_writeRichText:(BOOL)rich toURL:(NSURL *)url completionHandler:(void (^)(BOOL success, NSError *error))completion;
+{
+    [self dejal_performWithTextSnapshot:^(NSAttributedString *text)
+    {
+        NSRange range = NSMakeRange(0, [text length]);
+        NSError *error = nil;
+        BOOL success = NO;
+        
+        if (rich)
+        {
+            NSFileWrapper *wrapper = [text RTFDFileWrapperFromRange:range documentAttributes:@{}];
+            
+            success = [wrapper writeToURL:url options:NSFileWrapperWritingAtomic originalContentsURL:nil error:&error];
+        }
+        else
+        {
+            success = [[text RTFFromRange:range documentAttributes:@{}] writeToURL:url options:NSDataWritingAtomic error:&error];
+        }
+        
+        if (completion)
+        {
+            dispatch_async(dispatch_get_main_queue(), ^
+            {
+                completion(success, error);
+            });
+        }
+    }];
+}
+
+/**
+ Writes a RTF (or flattened RTFD, if rich is YES) edition of the text to the stream on a background queue, in bounded writes, then invokes the completion handler, if any, on the main queue.  The stream should already be open, and is left open.  It is scheduled on no run loop, so writes block the background queue, not the main thread.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_writeRichText:(BOOL)rich toStream:(NSOutputStream *)stream completionHandler:(void (^)(BOOL success, NSError *error))completion;
+{
+    [self dejal_performWithTextSnapshot:^(NSAttributedString *text)
+    {
+        NSRange range = NSMakeRange(0, [text length]);
+        NSData *data = rich ? [text RTFDFromRange:range documentAttributes:@{}] : [text RTFFromRange:range documentAttributes:@{}];
+        const uint8_t *bytes = [data bytes];
+        NSUInteger length = [data length];
+        NSUInteger offset = 0;
+        
+        while (offset < length)
+        {
+            NSInteger written = [stream write:bytes + offset maxLength:MIN(length - offset, 65536)];
+            
+            if (written <= 0)
+                break;
+            
+            offset += written;
+        }
+        
+        BOOL success = data && offset == length;
+        NSError *error = success ? nil : [stream streamError];
+        
+        if (completion)
+        {
+            dispatch_async(dispatch_get_main_queue(), ^
+            {
+                completion(success, error);
+            });
+        }
+    }];
+}
+
 
 // ----------------------------------------------------------------------------------------
 #pragma mark -
@@ -317,5 +803,158 @@
         [self dejal_setStringValue:@""];
 }
 
+/**
+ Replaces all of the text with the richest of the specified values, like -dejal_setRTFDValue:orRTF:orAttributedString:orString:, but suited to very large documents: the data is parsed on a background queue, then the first screenful is installed immediately, and the rest is appended in chunks on later main queue passes, so the view can draw and respond in between.  Non-contiguous layout is turned on, so only the visible text needs to be laid out; it is left on afterwards.
+ 
+ The progress handler, if any, is invoked on the main thread after each chunk; return NO to cancel the load, leaving the text loaded so far.  Starting another load, or calling -dejal_cancelLoading, also cancels it.  The completion handler, if any, is invoked on the main thread with YES if all of the text was loaded, and the time from this call until the first screenful was installed, for comparing against the synchronous method.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_loadRTFDValue:(NSData *)theRTFD orRTF:(NSData *)theRTF orAttributedString:(NSAttributedString *)attrString orString:(NSString *)string progressHandler:(BOOL (^)(NSUInteger charactersDone, NSUInteger totalCharacters))progressHandler completionHandler:(void (^)(BOOL finished, NSTimeInterval firstScreenfulTime))completion;
+{
+    CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
+    id token = [NSObject new];
+    NSDictionary *attributes = [self typingAttributes];
+    
+    objc_setAssociatedObject(self, @selector(dejal_cancelLoading), token, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    [[self layoutManager] setAllowsNonContiguousLayout:YES];
+    
+    __weak NSTextView *weakSelf = self;
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^
+    {
+        NSAttributedString *text = nil;
+        
+        if ([theRTFD length])
+            text = [[NSAttributedString alloc] initWithRTFD:theRTFD documentAttributes:NULL];
+        else if ([theRTF length])
+            text = [[NSAttributedString alloc] initWithRTF:theRTF documentAttributes:NULL];
+        else if ([attrString length])
+            text = [attrString copy];
+        else
+            text = [[NSAttributedString alloc] initWithString:string ?: @"" attributes:attributes];
+        
+        if (!text)
+            text = [[NSAttributedString alloc] initWithString:@"" attributes:attributes];
+        
+        dispatch_async(dispatch_get_main_queue(), ^
+        {
+            NSTextView *textView = weakSelf;
+            
+            if (!textView || objc_getAssociatedObject(textView, @selector(dejal_cancelLoading)) != token)
+            {
+                if (completion)
+                    completion(NO, 0.0);
+                
+                return;
+            }
+            
+            // Estimate a screenful generously, as the characters that would fill the visible area at the smallest likely size:
+            NSSize visibleSize = [textView visibleRect].size;
+            NSUInteger firstChunkLength = MAX((NSUInteger)(visibleSize.width * visibleSize.height / 20.0), 4096);
+            
+            [textView dejal_loadText:text fromIndex:0 chunkLength:firstChunkLength token:token startTime:startTime firstScreenfulTime:0.0 progressHandler:progressHandler completionHandler:completion];
+        });
+    });
+}
+
+/**
+ Returns the end of the chunk of the string starting at the index, of about the chunk length.  Extends to the end of the paragraph, unless that would more than double the chunk (e.g. a huge document with few or no newlines), in which case it ends at a composed character boundary instead, so a chunk never grows unbounded.
+ 
+ @author DJS 2026-10.
+*/
+
+static NSUInteger DejalChunkEndForLength(NSString *string, NSUInteger index, NSUInteger chunkLength)
+{
+    NSUInteger totalLength = [string length];
+    NSUInteger end = MIN(index + chunkLength, totalLength);
+    
+    if (end >= totalLength)
+        return totalLength;
+    
+    NSUInteger paragraphEnd = NSMaxRange([string paragraphRangeForRange:NSMakeRange(end - 1, 0)]);
+    
+    if (paragraphEnd - end <= chunkLength)
+        return paragraphEnd;
+    
+    return NSMaxRange([string rangeOfComposedCharacterSequenceAtIndex:end - 1]);
+}
+
+/**
+ Installs the next chunk of the text being loaded, ending at a paragraph boundary where reasonable (see DejalChunkEndForLength()), then schedules the following chunk.  The first chunk replaces the existing text.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_loadText:(NSAttributedString *)text fromIndex:(NSUInteger)index chunkLength:(NSUInteger)chunkLength token:(id)token startTime:(CFAbsoluteTime)startTime firstScreenfulTime:(NSTimeInterval)firstScreenfulTime progressHandler:(BOOL (^)(NSUInteger charactersDone, NSUInteger totalCharacters))progressHandler completionHandler:(void (^)(BOOL finished, NSTimeInterval firstScreenfulTime))completion;
+{
+    NSUInteger totalLength = [text length];
+    NSUInteger end = DejalChunkEndForLength([text string], index, chunkLength);
+    
+    NSTextStorage *textStorage = [self textStorage];
+    NSAttributedString *chunk = [text attributedSubstringFromRange:NSMakeRange(index, end - index)];
+    
+    [textStorage beginEditing];
+    
+    if (index == 0)
+        [textStorage replaceCharactersInRange:NSMakeRange(0, [textStorage length]) withAttributedString:chunk];
+    else
+        [textStorage appendAttributedString:chunk];
+    
+    [textStorage endEditing];
+    
+    if (index == 0)
+    {
+        [self setSelectedRange:NSMakeRange(0, 0)];
+        [self scrollRangeToVisible:NSMakeRange(0, 0)];
+        
+        firstScreenfulTime = CFAbsoluteTimeGetCurrent() - startTime;
+    }
+    
+    BOOL finished = end >= totalLength;
+    BOOL keepGoing = !progressHandler || progressHandler(end, totalLength);
+    
+    if (finished || !keepGoing)
+    {
+        if (objc_getAssociatedObject(self, @selector(dejal_cancelLoading)) == token)
+            objc_setAssociatedObject(self, @selector(dejal_cancelLoading), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+        
+        if (completion)
+            completion(finished, firstScreenfulTime);
+        
+        return;
+    }
+    
+    __weak NSTextView *weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^
+    {
+        NSTextView *textView = weakSelf;
+        
+        if (!textView || objc_getAssociatedObject(textView, @selector(dejal_cancelLoading)) != token)
+        {
+            if (completion)
+                completion(NO, firstScreenfulTime);
+            
+            return;
+        }
+        
+        [textView dejal_loadText:text fromIndex:end chunkLength:256 * 1024 token:token startTime:startTime firstScreenfulTime:firstScreenfulTime progressHandler:progressHandler completionHandler:completion];
+    });
+}
+
+/**
+ Cancels any load started via -dejal_loadRTFDValue:orRTF:orAttributedString:orString:progressHandler:completionHandler:, leaving the text loaded so far.  Its completion handler will be invoked with NO.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_cancelLoading;
+{
+    objc_setAssociatedObject(self, @selector(dejal_cancelLoading), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
 @end
 
@@ -33,7 +33,7 @@
 - (BOOL)dejal_isDark;
 
 - (void)dejal_addFullyConstrainedSubview:(NSView *)subview;
-- (void)dejal_addFullSizeConstraintsForSubview:(NSView *)subview;
+- (NSArray *)dejal_addFullSizeConstraintsForSubview:(NSView *)subview;
 
 @end
 
@@ -43,6 +43,15 @@
 // ----------------------------------------------------------------------------------------
 
 
+@interface DejalAutoresizeMaskSnapshot : NSObject
+
+@property (nonatomic, readonly) NSUInteger count;
+
+- (void)restore;
+
+@end
+
+
 @interface NSView (DejalSizing)
 
 - (NSArray *)dejal_adjustAutoresizeMasks;
@@ -50,6 +59,8 @@
 
 - (void)dejal_restoreAutoresizeMasks:(NSArray *)masks;
 
+- (DejalAutoresizeMaskSnapshot *)dejal_autoresizeMaskSnapshotAdjustingAroundPosition:(CGFloat)position stickPositionToTop:(BOOL)stickPositionToTop;
+
 @end
 
 
@@ -29,6 +29,7 @@
 
 
 #import "NSView+Dejal.h"
+#import <objc/runtime.h>
 
 
 @implementation NSView (DejalSubviews)
@@ -60,20 +61,184 @@
 }
 
 /**
- Adjusts the Auto Layout constraints of the specified subview of the reciever to keep it the full size of the receiver.
+ Adjusts the Auto Layout constraints of the specified subview of the reciever to keep it the full size of the receiver.  The four edge constraints are created directly with layout anchors (or visual format strings before OS X 10.11), and returned so the caller can deactivate them later.  They are remembered on the subview, so calling this again for the same subview and receiver just returns the existing active constraints instead of adding duplicates; if they were deactivated or the subview moved, new ones replace them.
  
  @author DJS 2015-01.
+ @version DJS 2026-10: Changed to use layout anchors instead of parsing visual format strings, to return the constraints, and to avoid duplicates.
 */
 
-- (void)dejal_addFullSizeConstraintsForSubview:(NSView *)subview;
+- (NSArray *)dejal_addFullSizeConstraintsForSubview:(NSView *)subview;
 {
+    if (!subview)
+        return nil;
+    
     // See also the IB checkbox for the root level of a view controller's views "Translates Mask Into Constraints":
     [subview setTranslatesAutoresizingMaskIntoConstraints:NO];
     
-    NSDictionary *views = NSDictionaryOfVariableBindings(subview);
+    NSArray *constraints = objc_getAssociatedObject(subview, @selector(dejal_addFullSizeConstraintsForSubview:));
+    BOOL reusable = constraints.count > 0;
+    
+    for (NSLayoutConstraint *constraint in constraints)
+    {
+        if (!constraint.active || (constraint.firstItem != self && constraint.secondItem != self))
+        {
+            reusable = NO;
+            break;
+        }
+    }
+    
+    if (reusable)
+        return constraints;
+    
+    [NSLayoutConstraint deactivateConstraints:constraints];
+    
+    // Layout anchors are only available on OS X 10.11 or later; use visual format strings on earlier versions:
+    if ([subview respondsToSelector:@selector(leadingAnchor)])
+    {
+        constraints = @[[subview.leadingAnchor constraintEqualToAnchor:self.leadingAnchor],
+                        [subview.trailingAnchor constraintEqualToAnchor:self.trailingAnchor],
+                        [subview.topAnchor constraintEqualToAnchor:self.topAnchor],
+                        [subview.bottomAnchor constraintEqualToAnchor:self.bottomAnchor]];
+    }
+    else
+    {
+        NSDictionary *views = NSDictionaryOfVariableBindings(subview);
+        
+        constraints = [[NSLayoutConstraint constraintsWithVisualFormat:@"H:|[subview]|" options:0 metrics:nil views:views] arrayByAddingObjectsFromArray:[NSLayoutConstraint constraintsWithVisualFormat:@"V:|[subview]|" options:0 metrics:nil views:views]];
+    }
+    
+    [NSLayoutConstraint activateConstraints:constraints];
     
-    [self addConstraints:[NSLayoutConstraint constraintsWithVisualFormat:@"H:|[subview]|" options:0 metrics:nil views:views]];
-    [self addConstraints:[NSLayoutConstraint constraintsWithVisualFormat:@"V:|[subview]|" options:0 metrics:nil views:views]];
+    objc_setAssociatedObject(subview, @selector(dejal_addFullSizeConstraintsForSubview:), constraints, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    return constraints;
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
+
+
+/**
+ Enumerates the views affected by the autoresize mask adjustments: the view itself and each of its superviews (with isAncestor YES), each followed by that ancestor's other subviews.  The previous ancestor is the one the current ancestor contains, or nil for the view itself.  This is the single traversal shared by the adjust and restore methods.
+ 
+ @author DJS 2026-10, based on the loops in -dejal_adjustAutoresizingAroundPosition:stickPositionToTop: and -dejal_restoreAutoresizeMasks:.
+*/
+
+static void DejalEnumerateAutoresizeHierarchy(NSView *view, void (^block)(NSView *view, BOOL isAncestor, NSView *previousAncestor))
+{
+    NSView *superview = view;
+    NSView *oldSuperview = nil;
+    
+    while (superview)
+    {
+        block(superview, YES, oldSuperview);
+        
+        for (NSView *subview in [superview subviews])
+        {
+            if (subview != oldSuperview)
+                block(subview, NO, oldSuperview);
+        }
+        
+        oldSuperview = superview;
+        superview = [superview superview];
+    }
+}
+
+
+typedef struct
+{
+    void *view;
+    NSAutoresizingMaskOptions mask;
+} DejalAutoresizeMaskEntry;
+
+
+@implementation DejalAutoresizeMaskSnapshot
+{
+    DejalAutoresizeMaskEntry *_entries;
+    NSUInteger _count;
+    NSUInteger _capacity;
+}
+
+/**
+ Releases the retained views and the buffer.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dealloc;
+{
+    for (NSUInteger i = 0; i < _count; i++)
+        CFRelease(_entries[i].view);
+    
+    free(_entries);
+}
+
+/**
+ Returns the number of views recorded.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSUInteger)count;
+{
+    return _count;
+}
+
+/**
+ Records the view and its current autoresize mask, retaining the view so the entry stays valid even if it is removed from the hierarchy.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)addView:(NSView *)view;
+{
+    if (_count == _capacity)
+    {
+        _capacity = _capacity ? _capacity * 2 : 32;
+        _entries = reallocf(_entries, _capacity * sizeof(DejalAutoresizeMaskEntry));
+        
+        if (!_entries)
+        {
+            _count = _capacity = 0;
+            return;
+        }
+    }
+    
+    _entries[_count].view = (__bridge_retained void *)view;
+    _entries[_count].mask = [view autoresizingMask];
+    _count++;
+}
+
+/**
+ Sets each recorded view's autoresize mask back to the recorded value.  This goes directly through the recorded views rather than walking the hierarchy again, so it is safe if views were added, removed or moved since the snapshot was taken.  May be called more than once.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)restore;
+{
+    for (NSUInteger i = 0; i < _count; i++)
+        [(__bridge NSView *)_entries[i].view setAutoresizingMask:_entries[i].mask];
+}
+
+/**
+ Returns the recorded masks as NSNumbers, in traversal order, for the legacy array-based methods.
+ 
+ @author DJS 2026-10.
+*/
+
+- (NSArray *)masks;
+{
+    NSMutableArray *masks = [NSMutableArray arrayWithCapacity:_count];
+    
+    for (NSUInteger i = 0; i < _count; i++)
+        [masks addObject:@(_entries[i].mask)];
+    
+    return masks;
 }
 
 @end
@@ -98,104 +263,92 @@
 }
 
 /**
- Adjusts the autoresize masks in the window so that when the window is resized, the receiver will expand vertically and other views will remain the same height.  Returns an array of the old masks, to be passed to -restoreAutoresizeMasks, below, to change the masks back to how they were before this method was invoked.
+ Adjusts the autoresize masks in the window so that when the window is resized, the receiver will expand vertically and other views will remain the same height.  Returns an array of the old masks, to be passed to -restoreAutoresizeMasks, below, to change the masks back to how they were before this method was invoked.  See also -dejal_autoresizeMaskSnapshotAdjustingAroundPosition:stickPositionToTop:, which is preferred.
  
  @author DJS 2006-01, based on code from my ViewsListView.
+ @version DJS 2026-10: Changed to use a snapshot.
 */
 
 - (NSArray *)dejal_adjustAutoresizingAroundPosition:(CGFloat)position stickPositionToTop:(BOOL)stickPositionToTop;
 {
-    NSMutableArray *subviewMasks = [NSMutableArray array];
-    NSView *superview = self;
-    NSView *oldSuperview = superview;
+    return [[self dejal_autoresizeMaskSnapshotAdjustingAroundPosition:position stickPositionToTop:stickPositionToTop] masks];
+}
+
+/**
+ Adjusts the autoresize masks in the window so that when the window is resized, the receiver will expand vertically and other views will remain the same height.  Returns a snapshot of the old masks, recorded in the same single traversal; send it -restore to change the masks back to how they were before this method was invoked.
+ 
+ @author DJS 2026-10, based on -dejal_adjustAutoresizingAroundPosition:stickPositionToTop:.
+*/
+
+- (DejalAutoresizeMaskSnapshot *)dejal_autoresizeMaskSnapshotAdjustingAroundPosition:(CGFloat)position stickPositionToTop:(BOOL)stickPositionToTop;
+{
+    DejalAutoresizeMaskSnapshot *snapshot = [DejalAutoresizeMaskSnapshot new];
+    __block CGFloat currentPosition = position;
     
-    while (superview)
+    DejalEnumerateAutoresizeHierarchy(self, ^(NSView *view, BOOL isAncestor, NSView *previousAncestor)
     {
-        // First adjust the superview's mask:
-        NSUInteger mask = [superview autoresizingMask];
-        [subviewMasks addObject:@(mask)];
-        
-        // Make it stick to the top and bottom of the window, and change height:
-        mask |= NSViewHeightSizable;
-        mask &= ~NSViewMaxYMargin;
-        mask &= ~NSViewMinYMargin;
+        [snapshot addView:view];
         
-        [superview setAutoresizingMask:mask];
+        NSAutoresizingMaskOptions mask = [view autoresizingMask];
         
-        NSArray *subviews = [superview subviews];
-        
-        for (NSView *subview in subviews)
+        if (isAncestor)
         {
+            // Subviews of ancestors are positioned around the previous ancestor:
+            if (previousAncestor)
+                currentPosition = NSMaxY([previousAncestor frame]);
             
-            if (subview != oldSuperview)
+            // Make it stick to the top and bottom of the window, and change height:
+            mask |= NSViewHeightSizable;
+            mask &= ~NSViewMaxYMargin;
+            mask &= ~NSViewMinYMargin;
+        }
+        else
+        {
+            BOOL stickToBottom = NSMaxY([view frame]) <= currentPosition;
+            
+            if (!stickPositionToTop && (NSMaxY([view frame]) == currentPosition))
+                stickToBottom = YES;
+            
+            if (stickToBottom)
             {
-                mask = [subview autoresizingMask];
-                BOOL stickToBottom = NSMaxY([subview frame]) <= position;
-                
-                if (!stickPositionToTop && (NSMaxY([subview frame]) == position))
-                    stickToBottom = YES;
-                
-                [subviewMasks addObject:@(mask)];
-                
-                if (stickToBottom)
-                {
-                    // This subview is below us.  Make it stick to the bottom of the window and not change height:
-                    mask &= ~NSViewHeightSizable;
-                    mask |= NSViewMaxYMargin;
-                    mask &= ~NSViewMinYMargin;
-                }
-                else
-                {
-                    // This subview is above us.  Make it stick to the top of the window, and not change height:
-                    mask &= ~NSViewHeightSizable;
-                    mask &= ~NSViewMaxYMargin;
-                    mask |= NSViewMinYMargin;
-                }
-                
-                [subview setAutoresizingMask:mask];
+                // This subview is below us.  Make it stick to the bottom of the window and not change height:
+                mask &= ~NSViewHeightSizable;
+                mask |= NSViewMaxYMargin;
+                mask &= ~NSViewMinYMargin;
+            }
+            else
+            {
+                // This subview is above us.  Make it stick to the top of the window, and not change height:
+                mask &= ~NSViewHeightSizable;
+                mask &= ~NSViewMaxYMargin;
+                mask |= NSViewMinYMargin;
             }
         }
         
-        // Go to this superview's superview and repeat the process; note that the looping algorithm must be replicated exactly in the restore method, below.  Ideally both methods should use another method to get the next subview, but I can't be bothered refactoring it at this stage, so just be aware of the issue:
-        oldSuperview = superview;
-        position = NSMaxY([superview frame]);
-        superview = [superview superview];
-    }
+        [view setAutoresizingMask:mask];
+    });
     
-    return subviewMasks;
+    return snapshot;
 }
 
 /**
- Changes the window's autoresizing masks back to how they were before -adjustAutoresizeMasks or -adjustAutoresizingAroundPosition:stickPositionToTop: was invoked.
+ Changes the window's autoresizing masks back to how they were before -adjustAutoresizeMasks or -adjustAutoresizingAroundPosition:stickPositionToTop: was invoked.  Since the array only contains masks, this has to walk the hierarchy again, so assumes it hasn't changed; prefer the snapshot method, above.
  
  @author DJS 2006-01, based on code from my ViewsListView.
+ @version DJS 2026-10: Changed to use the shared traversal.
 */
 
 - (void)dejal_restoreAutoresizeMasks:(NSArray *)masks;
 {
-    NSView *superview = self;
-    NSView *oldSuperview = superview;
     NSEnumerator *enumerator = [masks objectEnumerator];
     
-    while (superview)
+    DejalEnumerateAutoresizeHierarchy(self, ^(NSView *view, BOOL isAncestor, NSView *previousAncestor)
     {
-        // First item is the superview's mask:
-        [superview setAutoresizingMask:[[enumerator nextObject] unsignedIntegerValue]];
+        NSNumber *mask = [enumerator nextObject];
         
-        // Following items are the subview masks:
-        NSArray *subviews = [superview subviews];
-        
-        for (NSView *subview in subviews)
-        {
-            
-            if (subview != oldSuperview)
-                [subview setAutoresizingMask:[[enumerator nextObject] unsignedIntegerValue]];
-        }
-        
-        // Go to this superview's superview and repeat the process; note that the looping algorithm must be replicated exactly in the adjust method, above.  Ideally both methods should use another method to get the next subview, but I can't be bothered refactoring it at this stage, so just be aware of the issue:
-        oldSuperview = superview;
-        superview = [superview superview];
-    }
+        if (mask)
+            [view setAutoresizingMask:[mask unsignedIntegerValue]];
+    });
 }
 
 @end
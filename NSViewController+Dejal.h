@@ -60,5 +60,45 @@
 
 - (void)dejal_transitionSubviewFromViewController:(NSViewController *)fromViewController toViewController:(NSViewController *)toViewController options:(NSViewControllerTransitionOptions)options completionHandler:(void (^)(void))completion;
 
+/**
+ The maximum number of child view controllers kept in the reuse pool.  Defaults to 8.
+ 
+ @author DJS 2026-10.
+ */
+
+@property (nonatomic, setter=dejal_setReusePoolLimit:) NSUInteger dejal_reusePoolLimit;
+
+/**
+ Returns the child view controller in the reuse pool for the key, or creates it via the creation handler and adds it to the pool if not found.  The pool is a bounded LRU, so the least recently used controllers that aren't currently children of the receiver are released when the limit is exceeded.
+ 
+ @param key A key identifying the view controller, e.g. the identifier of a tab or inspector pane.
+ @param creationHandler A block that returns a new view controller for the key; may be nil to only look in the pool.
+ @returns The pooled or new view controller, or nil if there isn't one.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSViewController *)dejal_reusableChildViewControllerForKey:(id <NSCopying>)key creationHandler:(NSViewController * (^)(void))creationHandler;
+
+/**
+ Gets or creates the child view controller for the key as per -dejal_reusableChildViewControllerForKey:creationHandler:, and schedules its view to be loaded and laid out at the receiver's size when the main run loop is next idle (about to wait for events), so a later transition to it doesn't stall.
+ 
+ @param key A key identifying the view controller.
+ @param creationHandler A block that returns a new view controller for the key.
+ @returns The pooled or new view controller, or nil if there isn't one.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSViewController *)dejal_prewarmChildViewControllerForKey:(id <NSCopying>)key creationHandler:(NSViewController * (^)(void))creationHandler;
+
+/**
+ Releases all of the view controllers in the reuse pool, and cancels any pending prewarming.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)dejal_removeAllReusableChildViewControllers;
+
 @end
 
@@ -29,6 +29,136 @@
 
 #import "NSViewController+Dejal.h"
 #import "NSView+Dejal.h"
+#import <objc/runtime.h>
+
+
+static NSString * const DejalViewControllerPrewarmNotification = @"DejalViewControllerPrewarmNotification";
+
+
+@interface NSViewController (DejalPrivate)
+
+- (void)dejal_prewarmNextViewController;
+
+@end
+
+
+/**
+ Private reuse pool of child view controllers for a container view controller, keyed by the caller, with the most recently used last.  Also holds the controllers waiting to be prewarmed.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalViewControllerPool : NSObject
+
+@property (nonatomic, strong) NSMutableDictionary *controllers;
+@property (nonatomic, strong) NSMutableOrderedSet *keys;
+@property (nonatomic, strong) NSMutableArray *pendingPrewarm;
+@property (nonatomic, weak) NSViewController *parent;
+@property (nonatomic) NSUInteger limit;
+
+@end
+
+
+@implementation DejalViewControllerPool
+
+- (instancetype)init;
+{
+    if ((self = [super init]))
+    {
+        _controllers = [NSMutableDictionary dictionary];
+        _keys = [NSMutableOrderedSet orderedSet];
+        _pendingPrewarm = [NSMutableArray array];
+        _limit = 8;
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(prewarmNotification:) name:DejalViewControllerPrewarmNotification object:self];
+    }
+    
+    return self;
+}
+
+- (void)dealloc;
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+/**
+ Returns the notification used to prewarm the next pending controller.
+*/
+
+- (NSNotification *)prewarmNotification;
+{
+    return [NSNotification notificationWithName:DejalViewControllerPrewarmNotification object:self];
+}
+
+/**
+ Schedules the next pending controller to be prewarmed when the main run loop is idle, i.e. about to wait for events, in the default mode.  Coalesced, so scheduling again before then has no effect.
+*/
+
+- (void)schedulePrewarm;
+{
+    [[NSNotificationQueue defaultQueue] enqueueNotification:[self prewarmNotification] postingStyle:NSPostWhenIdle coalesceMask:NSNotificationCoalescingOnName | NSNotificationCoalescingOnSender forModes:@[NSDefaultRunLoopMode]];
+}
+
+/**
+ Cancels any scheduled prewarming.
+*/
+
+- (void)cancelPrewarm;
+{
+    [[NSNotificationQueue defaultQueue] dequeueNotificationsMatching:[self prewarmNotification] coalesceMask:NSNotificationCoalescingOnName | NSNotificationCoalescingOnSender];
+}
+
+/**
+ Posted when idle; prewarms the next pending controller.
+*/
+
+- (void)prewarmNotification:(NSNotification *)note;
+{
+    [self.parent dejal_prewarmNextViewController];
+}
+
+/**
+ Marks the key as the most recently used.
+*/
+
+- (void)touchKey:(id)key;
+{
+    [self.keys removeObject:key];
+    [self.keys addObject:key];
+}
+
+/**
+ Removes the least recently used controllers until within the limit, skipping any that are currently children of the container, since they're in use.
+*/
+
+- (void)trimForParent:(NSViewController *)parent;
+{
+    NSUInteger index = 0;
+    
+    while (self.keys.count > self.limit && index < self.keys.count)
+    {
+        id key = self.keys[index];
+        NSViewController *controller = self.controllers[key];
+        
+        if (controller.parentViewController == parent)
+        {
+            index++;
+        }
+        else
+        {
+            [self.pendingPrewarm removeObjectIdenticalTo:controller];
+            [self.controllers removeObjectForKey:key];
+            [self.keys removeObjectAtIndex:index];
+        }
+    }
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
 
 
 @implementation NSViewController (Dejal)
@@ -110,5 +240,168 @@
     }
 }
 
+/**
+ Returns the receiver's reuse pool, creating it if needed.
+ 
+ @author DJS 2026-10.
+ */
+
+- (DejalViewControllerPool *)dejal_viewControllerPool;
+{
+    DejalViewControllerPool *pool = objc_getAssociatedObject(self, @selector(dejal_viewControllerPool));
+    
+    if (!pool)
+    {
+        pool = [DejalViewControllerPool new];
+        pool.parent = self;
+        objc_setAssociatedObject(self, @selector(dejal_viewControllerPool), pool, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    
+    return pool;
+}
+
+/**
+ The maximum number of child view controllers kept in the reuse pool.  Defaults to 8.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSUInteger)dejal_reusePoolLimit;
+{
+    return [self dejal_viewControllerPool].limit;
+}
+
+- (void)dejal_setReusePoolLimit:(NSUInteger)limit;
+{
+    DejalViewControllerPool *pool = [self dejal_viewControllerPool];
+    
+    pool.limit = limit;
+    [pool trimForParent:self];
+}
+
+/**
+ Returns the child view controller in the reuse pool for the key, or creates it via the creation handler and adds it to the pool if not found.  The pool is a bounded LRU, so the least recently used controllers that aren't currently children of the receiver are released when the limit is exceeded.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSViewController *)dejal_reusableChildViewControllerForKey:(id <NSCopying>)key creationHandler:(NSViewController * (^)(void))creationHandler;
+{
+    if (!key)
+    {
+        return nil;
+    }
+    
+    DejalViewControllerPool *pool = [self dejal_viewControllerPool];
+    NSViewController *controller = pool.controllers[key];
+    
+    if (!controller && creationHandler)
+    {
+        controller = creationHandler();
+        
+        if (controller)
+        {
+            pool.controllers[key] = controller;
+        }
+    }
+    
+    if (controller)
+    {
+        [pool touchKey:key];
+        [pool trimForParent:self];
+    }
+    
+    return controller;
+}
+
+/**
+ Gets or creates the child view controller for the key as per -dejal_reusableChildViewControllerForKey:creationHandler:, and schedules its view to be loaded and laid out at the receiver's size when the main run loop is next idle (about to wait for events) in the default mode, so a later transition to it doesn't stall.  Controllers are prewarmed one per idle pass, so pending events are handled between them, to keep the app responsive.
+ 
+ @author DJS 2026-10.
+ */
+
+- (NSViewController *)dejal_prewarmChildViewControllerForKey:(id <NSCopying>)key creationHandler:(NSViewController * (^)(void))creationHandler;
+{
+    NSViewController *controller = [self dejal_reusableChildViewControllerForKey:key creationHandler:creationHandler];
+    DejalViewControllerPool *pool = [self dejal_viewControllerPool];
+    
+    if (controller && [pool.pendingPrewarm indexOfObjectIdenticalTo:controller] == NSNotFound)
+    {
+        [pool.pendingPrewarm addObject:controller];
+        
+        if (pool.pendingPrewarm.count == 1)
+        {
+            [pool schedulePrewarm];
+        }
+    }
+    
+    return controller;
+}
+
+/**
+ Prewarms the next pending view controller, and schedules the following one, if any, for the next idle pass.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)dejal_prewarmNextViewController;
+{
+    DejalViewControllerPool *pool = [self dejal_viewControllerPool];
+    NSViewController *controller = pool.pendingPrewarm.firstObject;
+    
+    if (!controller)
+    {
+        return;
+    }
+    
+    [pool.pendingPrewarm removeObjectAtIndex:0];
+    [self dejal_prewarmViewController:controller];
+    
+    if (pool.pendingPrewarm.count)
+    {
+        [pool schedulePrewarm];
+    }
+}
+
+/**
+ Loads the view controller's view if needed, and lays it out at the size of the receiver's view, if it isn't already in a view hierarchy.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)dejal_prewarmViewController:(NSViewController *)viewController;
+{
+    [[self dejal_viewControllerPool].pendingPrewarm removeObjectIdenticalTo:viewController];
+    
+    NSView *view = viewController.view;
+    
+    if (view.superview)
+    {
+        return;
+    }
+    
+    NSSize size = self.view.bounds.size;
+    
+    if (size.width > 0.0 && size.height > 0.0 && !NSEqualSizes(view.frame.size, size))
+    {
+        [view setFrameSize:size];
+    }
+    
+    [view layoutSubtreeIfNeeded];
+}
+
+/**
+ Releases all of the view controllers in the reuse pool, and cancels any pending prewarming.  Controllers that are currently children of the receiver are not affected, other than no longer being pooled.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)dejal_removeAllReusableChildViewControllers;
+{
+    [objc_getAssociatedObject(self, @selector(dejal_viewControllerPool)) cancelPrewarm];
+    
+    objc_setAssociatedObject(self, @selector(dejal_viewControllerPool), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
 @end
 
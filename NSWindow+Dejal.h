@@ -30,6 +30,15 @@
 #import <Cocoa/Cocoa.h>
 
 
+typedef NS_ENUM(NSInteger, DejalFadeEasing)
+{
+    DejalFadeEasingLinear = 0,
+    DejalFadeEasingEaseIn,
+    DejalFadeEasingEaseOut,
+    DejalFadeEasingEaseInOut
+};
+
+
 @interface NSWindow (Dejal)
 
 - (void)dejal_forceEndEditingForView:(NSView *)view;
@@ -40,7 +49,17 @@
 
 - (void)dejal_fadeIn:(BOOL)fadeIn forInterval:(NSTimeInterval)totalTime target:(id)target selector:(SEL)aSelector withObject:(id)object;
 
+- (void)dejal_fadeToAlpha:(CGFloat)alpha duration:(NSTimeInterval)duration easing:(DejalFadeEasing)easing completionHandler:(void (^)(BOOL finished))completion;
+- (void)dejal_fadeIn:(BOOL)fadeIn duration:(NSTimeInterval)duration easing:(DejalFadeEasing)easing completionHandler:(void (^)(BOOL finished))completion;
+- (void)dejal_cancelFade;
+
+@property (nonatomic, readonly) BOOL dejal_isFading;
+
 - (void)dejal_setFrameSoView:(NSView *)view hasSize:(NSSize)newViewSize centerHorizontalPostion:(BOOL)centerHoriz;
 
+- (void)dejal_performResizeTransaction:(void (^)(void))updates;
+- (BOOL)dejal_isInResizeTransaction;
+- (void)dejal_resizeView:(NSView *)view verticallyToHeight:(CGFloat)height;
+
 @end
 
@@ -28,6 +28,161 @@
 //
 
 #import "NSWindow+Dejal.h"
+#import "NSView+Dejal.h"
+#import <objc/runtime.h>
+#import <QuartzCore/QuartzCore.h>
+
+
+/**
+ Private state for a non-blocking window fade, driven by a run loop timer at the display refresh pace.  The timer retains this object, which only weakly references the window.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalWindowFade : NSObject
+
+@property (nonatomic, weak) NSWindow *window;
+@property (nonatomic) CGFloat fromAlpha;
+@property (nonatomic) CGFloat toAlpha;
+@property (nonatomic) NSTimeInterval duration;
+@property (nonatomic) DejalFadeEasing easing;
+@property (nonatomic) CFTimeInterval startTime;
+@property (nonatomic, strong) NSTimer *timer;
+@property (nonatomic, copy) void (^frameHandler)(void);
+@property (nonatomic, copy) void (^completionHandler)(BOOL finished);
+
+- (void)start;
+- (void)finish:(BOOL)finished;
+
+@end
+
+
+@implementation DejalWindowFade
+
+/**
+ Returns the eased progress for the linear progress, both from 0.0 to 1.0.
+*/
+
+- (CGFloat)easedProgress:(CGFloat)progress;
+{
+    switch (self.easing)
+    {
+        case DejalFadeEasingEaseIn:
+            return progress * progress;
+            
+        case DejalFadeEasingEaseOut:
+            return progress * (2.0 - progress);
+            
+        case DejalFadeEasingEaseInOut:
+            return progress < 0.5 ? 2.0 * progress * progress : -1.0 + (4.0 - 2.0 * progress) * progress;
+            
+        default:
+            return progress;
+    }
+}
+
+- (void)start;
+{
+    self.startTime = CACurrentMediaTime();
+    self.window.alphaValue = self.fromAlpha;
+    
+    self.timer = [NSTimer timerWithTimeInterval:1.0 / 60.0 target:self selector:@selector(step:) userInfo:nil repeats:YES];
+    self.timer.tolerance = 1.0 / 240.0;
+    
+    // Common modes, so the fade continues during event tracking and nested run loops:
+    [[NSRunLoop mainRunLoop] addTimer:self.timer forMode:NSRunLoopCommonModes];
+}
+
+- (void)step:(NSTimer *)timer;
+{
+    NSWindow *window = self.window;
+    
+    if (!window)
+    {
+        [self finish:NO];
+        return;
+    }
+    
+    CGFloat progress = self.duration > 0.0 ? (CACurrentMediaTime() - self.startTime) / self.duration : 1.0;
+    
+    if (progress >= 1.0)
+    {
+        window.alphaValue = self.toAlpha;
+        
+        if (self.frameHandler)
+            self.frameHandler();
+        
+        [self finish:YES];
+        return;
+    }
+    
+    window.alphaValue = self.fromAlpha + (self.toAlpha - self.fromAlpha) * [self easedProgress:progress];
+    
+    if (self.frameHandler)
+        self.frameHandler();
+}
+
+- (void)finish:(BOOL)finished;
+{
+    [self.timer invalidate];
+    self.timer = nil;
+    
+    NSWindow *window = self.window;
+    
+    if (window && objc_getAssociatedObject(window, @selector(dejal_cancelFade)) == self)
+        objc_setAssociatedObject(window, @selector(dejal_cancelFade), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    void (^completionHandler)(BOOL finished) = self.completionHandler;
+    
+    self.completionHandler = nil;
+    self.frameHandler = nil;
+    
+    if (completionHandler)
+        completionHandler(finished);
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
+
+
+/**
+ Private state for a window resize transaction: the views that want to grow, in the order requested, and the height each wants.
+ 
+ @author DJS 2026-10.
+*/
+
+@interface DejalWindowResizeTransaction : NSObject
+
+@property (nonatomic) NSUInteger depth;
+@property (nonatomic, strong) NSMutableArray *views;
+@property (nonatomic, strong) NSMapTable *heights;
+
+@end
+
+
+@implementation DejalWindowResizeTransaction
+
+- (instancetype)init;
+{
+    if ((self = [super init]))
+    {
+        _views = [NSMutableArray array];
+        _heights = [NSMapTable strongToStrongObjectsMapTable];
+    }
+    
+    return self;
+}
+
+@end
+
+
+// ----------------------------------------------------------------------------------------
+#pragma mark -
+// ----------------------------------------------------------------------------------------
 
 
 @implementation NSWindow (Dejal)
@@ -70,7 +225,7 @@
 }
 
 /**
- Fades a transparent window to opaque if fadeIn is YES, otherwise vice versa, taking the indicated total time to make the transition.  See also fadeIn:forInterval:target:selector:withObject: if you want to do other work while the window is fading in or out.
+ Fades a transparent window to opaque if fadeIn is YES, otherwise vice versa, taking the indicated total time to make the transition.  See also fadeIn:forInterval:target:selector:withObject: if you want to do other work while the window is fading in or out, or -dejal_fadeIn:duration:easing:completionHandler: to return immediately.
 
  @author DJS 2003-07.
  */
@@ -85,37 +240,110 @@
 
  - (void)doSomethingDuringFadeIn:(id)object;
  
+ This method blocks until the fade is complete, without running the run loop, so no other events, timers or queued blocks are processed in the meantime (as always).  It now sleeps between frames, at about the display refresh rate, rather than spinning, so the selector is sent once per frame.  Use -dejal_fadeIn:duration:easing:completionHandler: to return immediately instead.
+ 
  @author DJS 2003-01.
  @changed DJS 2003-07: changed to make into a category.
+ @version DJS 2026-10: Changed to sleep between frames instead of a busy loop, and cancel any non-blocking fade first.
 */
 
 - (void)dejal_fadeIn:(BOOL)fadeIn forInterval:(NSTimeInterval)totalTime target:(id)target selector:(SEL)aSelector withObject:(id)object
 {
-    NSDate *start = [NSDate date];
-    NSTimeInterval elapsedTime;
-    CGFloat percent;
-
+    [self dejal_cancelFade];
+    
+    CFTimeInterval start = CACurrentMediaTime();
+    CGFloat progress;
+    
     do
     {
-        elapsedTime = -[start timeIntervalSinceNow];
-        percent = (elapsedTime * 100.0) / totalTime;
+        progress = totalTime > 0.0 ? (CACurrentMediaTime() - start) / totalTime : 1.0;
+        
+        // Clamped to 0-100%, so the last frame is fully in or out:
+        [self dejal_fadeTo:(fadeIn ? progress : 1.0 - progress) * 100.0];
+        
+        if (target && aSelector)
+        {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Warc-performSelector-leaks"
+            [target performSelector:aSelector withObject:object];
+#pragma clang diagnostic pop
+        }
+        
+        if (progress < 1.0)
+            [NSThread sleepForTimeInterval:1.0 / 60.0];
+    }
+    while (progress < 1.0);
+}
+
+/**
+ Fades the window from its current alpha value to the specified one, over the duration and with the easing curve, returning immediately.  The fade is driven by a timer paced to the display refresh rate, so doesn't block the main thread.  If the window is already fading, that fade is cancelled (its completion handler is invoked with NO) and this one continues from the current alpha value.  The completion handler, if any, is invoked with YES when the fade completes, or NO if it was cancelled.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_fadeToAlpha:(CGFloat)alpha duration:(NSTimeInterval)duration easing:(DejalFadeEasing)easing completionHandler:(void (^)(BOOL finished))completion;
+{
+    [self dejal_fadeFromAlpha:self.alphaValue toAlpha:alpha duration:duration easing:easing frameHandler:nil completionHandler:completion];
+}
 
-//        NSLog(@"time = %f; percent = %d", elapsedTime, percent);
+/**
+ Fades the window to opaque if fadeIn is YES, otherwise to transparent, from its current alpha value, returning immediately.  See -dejal_fadeToAlpha:duration:easing:completionHandler: for details.
+ 
+ @author DJS 2026-10.
+*/
 
-        if (!fadeIn)
-            percent = 100.0 - percent;
+- (void)dejal_fadeIn:(BOOL)fadeIn duration:(NSTimeInterval)duration easing:(DejalFadeEasing)easing completionHandler:(void (^)(BOOL finished))completion;
+{
+    [self dejal_fadeToAlpha:fadeIn ? 1.0 : 0.0 duration:duration easing:easing completionHandler:completion];
+}
 
-        [self dejal_fadeTo:percent];
+/**
+ Starts a non-blocking fade between the alpha values, cancelling any existing fade of the receiver.  The frame handler, if any, is invoked after each frame.
+ 
+ @author DJS 2026-10.
+*/
 
-        if (target && aSelector)
-            [target performSelector:aSelector withObject:object];
-    }
-    while (elapsedTime < totalTime);
+- (void)dejal_fadeFromAlpha:(CGFloat)fromAlpha toAlpha:(CGFloat)toAlpha duration:(NSTimeInterval)duration easing:(DejalFadeEasing)easing frameHandler:(void (^)(void))frameHandler completionHandler:(void (^)(BOOL finished))completion;
+{
+    [self dejal_cancelFade];
+    
+    DejalWindowFade *fade = [DejalWindowFade new];
+    
+    fade.window = self;
+    fade.fromAlpha = MIN(MAX(fromAlpha, 0.0), 1.0);
+    fade.toAlpha = MIN(MAX(toAlpha, 0.0), 1.0);
+    fade.duration = duration;
+    fade.easing = easing;
+    fade.frameHandler = frameHandler;
+    fade.completionHandler = completion;
+    
+    objc_setAssociatedObject(self, @selector(dejal_cancelFade), fade, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    
+    [fade start];
+}
+
+/**
+ Stops any fade of the receiver that is in progress, leaving the alpha value as it currently is, and invokes the fade's completion handler with NO.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_cancelFade;
+{
+    DejalWindowFade *fade = objc_getAssociatedObject(self, @selector(dejal_cancelFade));
+    
+    [fade finish:NO];
+}
 
-    if (fadeIn)
-        [self dejal_fadeTo:100.0];
-    else
-        [self dejal_fadeTo:0.0];
+/**
+ Returns YES if the receiver is currently fading via one of the above methods.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_isFading;
+{
+    return objc_getAssociatedObject(self, @selector(dejal_cancelFade)) != nil;
 }
 
 /**
@@ -145,5 +373,124 @@
     [self setFrame:newWindowFrame display:YES animate:[self isVisible]];
 }
 
+/**
+ Groups vertical view resizes, so a number of views can grow with a single window resize.  Within the updates block, -dejal_resizeView:verticallyToHeight: (and so NSTextField's -dejal_resizeWindowVerticallyToFit) just records the requested heights.  When the outermost transaction ends, each view is grown in turn by resizing the content view, with its autoresize masks adjusted around it, then the window is resized once to the combined height.  Transactions may be nested.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_performResizeTransaction:(void (^)(void))updates;
+{
+    DejalWindowResizeTransaction *transaction = objc_getAssociatedObject(self, @selector(dejal_performResizeTransaction:));
+    
+    if (!transaction)
+    {
+        transaction = [DejalWindowResizeTransaction new];
+        objc_setAssociatedObject(self, @selector(dejal_performResizeTransaction:), transaction, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    
+    transaction.depth++;
+    
+    @try
+    {
+        if (updates)
+            updates();
+    }
+    @finally
+    {
+        transaction.depth--;
+        
+        if (!transaction.depth)
+        {
+            objc_setAssociatedObject(self, @selector(dejal_performResizeTransaction:), nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+            
+            [self dejal_commitResizeTransaction:transaction];
+        }
+    }
+}
+
+/**
+ Returns YES if within a -dejal_performResizeTransaction: block.
+ 
+ @author DJS 2026-10.
+*/
+
+- (BOOL)dejal_isInResizeTransaction;
+{
+    return objc_getAssociatedObject(self, @selector(dejal_performResizeTransaction:)) != nil;
+}
+
+/**
+ Resizes the window vertically so the view, which must be in the receiver, has the specified height, using the view's autoresize masks to keep the other views in place.  If within a resize transaction, the height is just recorded, and applied when the transaction ends; requesting a view more than once uses the last height.
+ 
+ @author DJS 2026-10, based on NSTextField's -dejal_resizeWindowVerticallyToFit.
+*/
+
+- (void)dejal_resizeView:(NSView *)view verticallyToHeight:(CGFloat)height;
+{
+    if (!view)
+        return;
+    
+    DejalWindowResizeTransaction *transaction = objc_getAssociatedObject(self, @selector(dejal_performResizeTransaction:));
+    
+    if (transaction)
+    {
+        if (![transaction.heights objectForKey:view])
+            [transaction.views addObject:view];
+        
+        [transaction.heights setObject:@(height) forKey:view];
+        
+        return;
+    }
+    
+    DejalAutoresizeMaskSnapshot *masks = [view dejal_autoresizeMaskSnapshotAdjustingAroundPosition:NSMaxY([view frame]) stickPositionToTop:YES];
+    
+    [self dejal_setFrameSoView:view hasSize:NSMakeSize(NSWidth([view frame]), height) centerHorizontalPostion:NO];
+    
+    [masks restore];
+}
+
+/**
+ Applies the heights recorded in the transaction: grows the content view for each view in turn, then resizes the window once.  Subview autoresizing is disabled during the window resize, since the content view is already the final size.
+ 
+ @author DJS 2026-10.
+*/
+
+- (void)dejal_commitResizeTransaction:(DejalWindowResizeTransaction *)transaction;
+{
+    NSView *contentView = [self contentView];
+    CGFloat oldContentHeight = NSHeight([contentView frame]);
+    
+    for (NSView *view in transaction.views)
+    {
+        CGFloat deltaV = [[transaction.heights objectForKey:view] doubleValue] - NSHeight([view frame]);
+        
+        if (deltaV == 0.0 || [view window] != self)
+            continue;
+        
+        DejalAutoresizeMaskSnapshot *masks = [view dejal_autoresizeMaskSnapshotAdjustingAroundPosition:NSMaxY([view frame]) stickPositionToTop:YES];
+        
+        [contentView setFrameSize:NSMakeSize(NSWidth([contentView frame]), NSHeight([contentView frame]) + deltaV)];
+        
+        [masks restore];
+    }
+    
+    CGFloat deltaV = NSHeight([contentView frame]) - oldContentHeight;
+    
+    if (deltaV == 0.0)
+        return;
+    
+    NSRect contentRect = [self contentRectForFrameRect:[self frame]];
+    
+    contentRect.origin.y -= deltaV;
+    contentRect.size.height += deltaV;
+    
+    BOOL autoresizesSubviews = [contentView autoresizesSubviews];
+    
+    [contentView setAutoresizesSubviews:NO];
+    [self setFrame:[self frameRectForContentRect:contentRect] display:YES animate:[self isVisible]];
+    [contentView setAutoresizesSubviews:autoresizesSubviews];
+}
+
 @end
 
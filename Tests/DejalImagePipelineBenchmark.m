@@ -0,0 +1,136 @@
+//
+//  DejalImagePipelineBenchmark.m
+//  Dejal Open Source Categories
+//
+//  Created by David Sinclair on Sat Oct 17 2026.
+//  Copyright (c) 2026 Dejal Systems, LLC. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification,
+//  are permitted provided that the following conditions are met:
+//
+//  - Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+//  - Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+//  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+//  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+//  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+//  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/*
+ Compares the throughput of +[NSImage dejal_processImages:operations:encodePNG:compression:backingScaleFactor:maxInFlight:resultHandler:completionHandler:] against applying the same steps one image at a time on the main thread with the existing category methods: -dejal_tintedImageWithColor:, -dejal_applyBadge:withAlpha:scale: and -dejal_PNGRepresentation.  Both paths produce a tinted, badged PNG of each image.  Build and run from the repository folder on a Mac with e.g.:
+ 
+ clang -fobjc-arc -O2 -I. Tests/DejalImagePipelineBenchmark.m NSImage+Dejal.m DejalPixelKernels.c -framework Cocoa -o /tmp/DejalImagePipelineBenchmark && /tmp/DejalImagePipelineBenchmark 200 512
+ 
+ The optional arguments are the number of images (default 200) and their width and height in points (default 512).  Exits with a non-zero status if either path fails to produce every PNG.
+*/
+
+#import <Cocoa/Cocoa.h>
+#import "NSImage+Dejal.h"
+
+
+/**
+ Returns test images of the specified size, each with a different gradient and shapes, so the PNG encoder has varied content.
+*/
+
+static NSArray *DejalBenchmarkImages(NSUInteger count, CGFloat side)
+{
+    NSMutableArray *images = [NSMutableArray arrayWithCapacity:count];
+    
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        CGFloat hue = (CGFloat)i / MAX(count, 1);
+        
+        NSImage *image = [NSImage dejal_imageWithSize:NSMakeSize(side, side) backingScaleFactor:1.0 usingBlock:^(NSRect bounds)
+                          {
+                              NSGradient *gradient = [[NSGradient alloc] initWithStartingColor:[NSColor colorWithCalibratedHue:hue saturation:0.8 brightness:0.9 alpha:1.0] endingColor:[NSColor colorWithCalibratedHue:1.0 - hue saturation:0.6 brightness:0.4 alpha:0.5]];
+                              
+                              [gradient drawInRect:bounds angle:45.0 + i];
+                              
+                              [[NSColor colorWithCalibratedWhite:1.0 alpha:0.6] set];
+                              [[NSBezierPath bezierPathWithOvalInRect:NSInsetRect(bounds, side / 4.0, side / 5.0)] fill];
+                          }];
+        
+        [images addObject:image];
+    }
+    
+    return images;
+}
+
+int main(int argc, const char *argv[])
+{
+    @autoreleasepool
+    {
+        [NSApplication sharedApplication];
+        
+        NSUInteger count = argc > 1 ? (NSUInteger)MAX(atoi(argv[1]), 1) : 200;
+        CGFloat side = argc > 2 ? MAX(atof(argv[2]), 16.0) : 512.0;
+        NSArray *images = DejalBenchmarkImages(count, side);
+        NSColor *tint = [NSColor colorWithCalibratedRed:0.2 green:0.4 blue:0.9 alpha:0.5];
+        NSImage *badge = DejalBenchmarkImages(1, side / 2.0).firstObject;
+        NSUInteger sequentialCount = 0;
+        __block NSUInteger pipelineCount = 0;
+        __block NSTimeInterval pipelineTime = 0.0;
+        __block BOOL done = NO;
+        
+        // Sequential, with the existing methods, which draw via -lockFocus so must run on the main thread:
+        CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
+        
+        for (NSImage *image in images)
+        {
+            @autoreleasepool
+            {
+                NSImage *tinted = [image dejal_tintedImageWithColor:tint];
+                
+                [tinted dejal_applyBadge:badge withAlpha:1.0 scale:0.5];
+                
+                if ([tinted dejal_PNGRepresentation].length)
+                    sequentialCount++;
+            }
+        }
+        
+        NSTimeInterval sequentialTime = CFAbsoluteTimeGetCurrent() - startTime;
+        
+        // The pipeline, delivering results to the main queue, so run the main run loop until it completes:
+        NSArray *operations = @[@{@"Operation" : @"Tint", @"Color" : tint},
+                                @{@"Operation" : @"Badge", @"Badge" : badge, @"Alpha" : @1.0, @"Scale" : @0.5}];
+        
+        [NSImage dejal_processImages:images operations:operations encodePNG:YES compression:DejalPNGCompressionDefault backingScaleFactor:1.0 maxInFlight:0 resultHandler:^(NSUInteger index, NSImage *image, NSData *pngData)
+         {
+             if (pngData.length)
+                 pipelineCount++;
+         }
+                   completionHandler:^(NSTimeInterval elapsedTime)
+         {
+             pipelineTime = elapsedTime;
+             done = YES;
+         }];
+        
+        while (!done)
+            [[NSRunLoop mainRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate distantFuture]];
+        
+        printf("%lu images of %.0f x %.0f points, tinted, badged and encoded as PNG:\n", (unsigned long)count, side, side);
+        printf("  Sequential: %8.3f s, %8.1f images/s\n", sequentialTime, count / MAX(sequentialTime, 1e-9));
+        printf("  Pipeline:   %8.3f s, %8.1f images/s (at most %lu images in flight)\n", pipelineTime, count / MAX(pipelineTime, 1e-9), (unsigned long)(2 * [NSProcessInfo processInfo].activeProcessorCount));
+        printf("  Speedup:    %8.2fx\n", sequentialTime / MAX(pipelineTime, 1e-9));
+        
+        if (sequentialCount != count || pipelineCount != count)
+        {
+            fprintf(stderr, "Only %lu sequential and %lu pipeline PNGs of %lu were produced\n", (unsigned long)sequentialCount, (unsigned long)pipelineCount, (unsigned long)count);
+            return EXIT_FAILURE;
+        }
+    }
+    
+    return EXIT_SUCCESS;
+}
+
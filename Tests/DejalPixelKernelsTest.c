@@ -0,0 +1,171 @@
+//
+//  DejalPixelKernelsTest.c
+//  Dejal Open Source Categories
+//
+//  Created by David Sinclair on Sat Oct 17 2026.
+//  Copyright (c) 2026 Dejal Systems, LLC. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification,
+//  are permitted provided that the following conditions are met:
+//
+//  - Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+//  - Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+//  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+//  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+//  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+//  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/*
+ Checks that the vectorized pixel kernels in DejalPixelKernels.c produce exactly the same results as their scalar reference versions, for random pixels (including non-premultiplied ones), tints and alphas, with widths that exercise the leftover pixels at the end of each row and padded rows.  Also checks the flipped copy.  Doesn't need AppKit, so can be run on any platform; build and run from the repository folder with e.g.:
+ 
+ cc -O2 -I. Tests/DejalPixelKernelsTest.c DejalPixelKernels.c -o /tmp/DejalPixelKernelsTest && /tmp/DejalPixelKernelsTest
+ 
+ Exits with a non-zero status if any case differs.
+*/
+
+#include "DejalPixelKernels.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+static const size_t DejalTestCaseCount = 2000;
+
+
+static uint8_t *DejalRandomPixels(size_t length)
+{
+    uint8_t *pixels = malloc(length);
+    
+    for (size_t i = 0; i < length; i++)
+        pixels[i] = (uint8_t)(rand() & 0xFF);
+    
+    return pixels;
+}
+
+static int DejalTestTint(size_t testCase, size_t width, size_t height, size_t bytesPerRow)
+{
+    uint8_t tint[4] = {(uint8_t)rand(), (uint8_t)rand(), (uint8_t)rand(), (uint8_t)rand()};
+    uint8_t *vector = DejalRandomPixels(bytesPerRow * height);
+    uint8_t *scalar = malloc(bytesPerRow * height);
+    
+    memcpy(scalar, vector, bytesPerRow * height);
+    
+    DejalTintSourceAtopRGBA(vector, bytesPerRow, width, height, tint);
+    DejalTintSourceAtopRGBAScalar(scalar, bytesPerRow, width, height, tint);
+    
+    int failed = memcmp(vector, scalar, bytesPerRow * height) != 0;
+    
+    if (failed)
+        fprintf(stderr, "Tint case %zu differs (%zu x %zu, %zu bytes per row)\n", testCase, width, height, bytesPerRow);
+    
+    free(vector);
+    free(scalar);
+    
+    return failed;
+}
+
+static int DejalTestComposite(size_t testCase, size_t width, size_t height, size_t bytesPerRow)
+{
+    uint8_t alpha = (uint8_t)rand();
+    uint8_t *source = DejalRandomPixels(bytesPerRow * height);
+    uint8_t *vector = DejalRandomPixels(bytesPerRow * height);
+    uint8_t *scalar = malloc(bytesPerRow * height);
+    
+    memcpy(scalar, vector, bytesPerRow * height);
+    
+    DejalCompositeSourceOverRGBA(source, bytesPerRow, vector, bytesPerRow, width, height, alpha);
+    DejalCompositeSourceOverRGBAScalar(source, bytesPerRow, scalar, bytesPerRow, width, height, alpha);
+    
+    int failed = memcmp(vector, scalar, bytesPerRow * height) != 0;
+    
+    if (failed)
+        fprintf(stderr, "Composite case %zu differs (%zu x %zu, %zu bytes per row, alpha %u)\n", testCase, width, height, bytesPerRow, alpha);
+    
+    free(source);
+    free(vector);
+    free(scalar);
+    
+    return failed;
+}
+
+static int DejalTestFlip(size_t testCase, size_t width, size_t height, size_t bytesPerRow)
+{
+    uint8_t *source = DejalRandomPixels(bytesPerRow * height);
+    uint8_t *destination = calloc(bytesPerRow, height);
+    int failed = 0;
+    
+    DejalCopyFlippedRGBA(source, bytesPerRow, destination, bytesPerRow, width, height);
+    
+    for (size_t y = 0; y < height && !failed; y++)
+        failed = memcmp(destination + (height - 1 - y) * bytesPerRow, source + y * bytesPerRow, width * 4) != 0;
+    
+    if (failed)
+        fprintf(stderr, "Flip case %zu differs (%zu x %zu, %zu bytes per row)\n", testCase, width, height, bytesPerRow);
+    
+    free(source);
+    free(destination);
+    
+    return failed;
+}
+
+int main(void)
+{
+    size_t failures = 0;
+    
+    srand(20261017);
+    
+    for (size_t testCase = 0; testCase < DejalTestCaseCount; testCase++)
+    {
+        size_t width = 1 + (size_t)(rand() % 67);
+        size_t height = 1 + (size_t)(rand() % 9);
+        size_t bytesPerRow = width * 4 + (size_t)(rand() % 3) * 16;
+        
+        failures += DejalTestTint(testCase, width, height, bytesPerRow);
+        failures += DejalTestComposite(testCase, width, height, bytesPerRow);
+        failures += DejalTestFlip(testCase, width, height, bytesPerRow);
+    }
+    
+    // Exhaustively check every destination alpha and tint alpha for a single channel value:
+    for (unsigned tintAlpha = 0; tintAlpha < 256; tintAlpha++)
+    {
+        uint8_t tint[4] = {(uint8_t)(tintAlpha / 2), 255, 0, (uint8_t)tintAlpha};
+        uint8_t vector[256 * 4];
+        uint8_t scalar[256 * 4];
+        
+        for (unsigned pixel = 0; pixel < 256; pixel++)
+        {
+            vector[pixel * 4] = (uint8_t)pixel;
+            vector[pixel * 4 + 1] = (uint8_t)(255 - pixel);
+            vector[pixel * 4 + 2] = (uint8_t)(pixel / 2);
+            vector[pixel * 4 + 3] = (uint8_t)pixel;
+        }
+        
+        memcpy(scalar, vector, sizeof(vector));
+        
+        DejalTintSourceAtopRGBA(vector, sizeof(vector), 256, 1, tint);
+        DejalTintSourceAtopRGBAScalar(scalar, sizeof(scalar), 256, 1, tint);
+        
+        if (memcmp(vector, scalar, sizeof(vector)) != 0)
+        {
+            fprintf(stderr, "Exhaustive tint alpha %u differs\n", tintAlpha);
+            failures++;
+        }
+    }
+    
+    printf("%zu random cases, %zu failures\n", DejalTestCaseCount, failures);
+    
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
@@ -0,0 +1,175 @@
+//
+//  DejalTextLoadBenchmark.m
+//  Dejal Open Source Categories
+//
+//  Created by David Sinclair on Sat Oct 17 2026.
+//  Copyright (c) 2026 Dejal Systems, LLC. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification,
+//  are permitted provided that the following conditions are met:
+//
+//  - Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+//  - Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+//  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+//  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+//  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+//  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+//  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+//  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+//  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/*
+ Compares the time to first paint of a large RTF document in a text view between the existing synchronous path (-dejal_setRTFValue:, i.e. -replaceCharactersInRange:withRTF:) and -dejal_loadRTFDValue:orRTF:orAttributedString:orString:progressHandler:completionHandler:, which installs the first screenful and appends the rest in chunks.  Also reports the time until the whole document is loaded, and the longest main thread stall between chunks.  A document with a single huge paragraph is also tried, to check the first chunk stays small.  Build and run from the repository folder on a Mac, with the DejalFoundationCategories checked out alongside, with e.g.:
+ 
+ clang -fobjc-arc -O2 -I. -I../DejalFoundationCategories Tests/DejalTextLoadBenchmark.m NSTextView+Dejal.m ../DejalFoundationCategories/*.m -framework Cocoa -o /tmp/DejalTextLoadBenchmark && /tmp/DejalTextLoadBenchmark 20
+ 
+ The optional argument is the approximate document size in megabytes (default 20).  Exits with a non-zero status if the chunked load doesn't finish, or ends up with different text.
+*/
+
+#import <Cocoa/Cocoa.h>
+#import "NSTextView+Dejal.h"
+
+
+/**
+ Returns RTF data for a document of about the specified number of characters, with varied fonts and colors.  If paragraphs is NO, it is all one paragraph.
+*/
+
+static NSData *DejalBenchmarkRTF(NSUInteger length, BOOL paragraphs)
+{
+    NSMutableAttributedString *text = [NSMutableAttributedString new];
+    NSArray *fonts = @[[NSFont systemFontOfSize:13.0], [NSFont boldSystemFontOfSize:13.0], [NSFont userFixedPitchFontOfSize:12.0]];
+    NSArray *colors = @[[NSColor textColor], [NSColor blueColor], [NSColor colorWithCalibratedRed:0.6 green:0.1 blue:0.1 alpha:1.0]];
+    NSUInteger run = 0;
+    
+    while (text.length < length)
+    {
+        NSString *string = [NSString stringWithFormat:@"Run %lu of the benchmark text, with some words to wrap across the width of the view%@", (unsigned long)run, paragraphs && run % 8 == 7 ? @".\n" : @". "];
+        
+        [text appendAttributedString:[[NSAttributedString alloc] initWithString:string attributes:@{NSFontAttributeName : fonts[run % fonts.count], NSForegroundColorAttributeName : colors[run % colors.count]}]];
+        run++;
+    }
+    
+    return [text RTFFromRange:NSMakeRange(0, text.length) documentAttributes:@{}];
+}
+
+/**
+ Returns a new text view in a scroll view in an on-screen window, so drawing is real.
+*/
+
+static NSTextView *DejalBenchmarkTextView(void)
+{
+    NSWindow *window = [[NSWindow alloc] initWithContentRect:NSMakeRect(100.0, 100.0, 800.0, 600.0) styleMask:NSWindowStyleMaskTitled backing:NSBackingStoreBuffered defer:NO];
+    NSScrollView *scrollView = [[NSScrollView alloc] initWithFrame:[window.contentView bounds]];
+    NSTextView *textView = [[NSTextView alloc] initWithFrame:NSMakeRect(0.0, 0.0, scrollView.contentSize.width, scrollView.contentSize.height)];
+    
+    window.releasedWhenClosed = NO;
+    scrollView.hasVerticalScroller = YES;
+    scrollView.documentView = textView;
+    textView.autoresizingMask = NSViewWidthSizable;
+    window.contentView = scrollView;
+    [window orderFront:nil];
+    [window display];
+    
+    return textView;
+}
+
+/**
+ Loads the RTF both ways, printing the results.  Returns NO if the chunked load failed.
+*/
+
+static BOOL DejalBenchmarkLoad(NSString *name, NSData *rtf)
+{
+    // Synchronous: the first paint can only happen after the whole document is installed:
+    NSTextView *syncTextView = DejalBenchmarkTextView();
+    CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
+    
+    syncTextView.dejal_RTFValue = rtf;
+    [syncTextView.window display];
+    
+    NSTimeInterval syncTime = CFAbsoluteTimeGetCurrent() - startTime;
+    NSString *expectedString = [syncTextView.string copy];
+    
+    [syncTextView.window close];
+    
+    // Chunked: paint after the first chunk, and measure the gaps between chunks:
+    NSTextView *textView = DejalBenchmarkTextView();
+    __block NSTimeInterval firstPaintTime = 0.0;
+    __block NSTimeInterval longestChunkTime = 0.0;
+    __block CFAbsoluteTime chunkStartTime = 0.0;
+    __block NSTimeInterval totalTime = 0.0;
+    __block BOOL loaded = NO;
+    __block BOOL done = NO;
+    
+    startTime = CFAbsoluteTimeGetCurrent();
+    
+    [textView dejal_loadRTFDValue:nil orRTF:rtf orAttributedString:nil orString:nil progressHandler:^BOOL(NSUInteger charactersDone, NSUInteger totalCharacters)
+     {
+         CFAbsoluteTime now = CFAbsoluteTimeGetCurrent();
+         
+         if (firstPaintTime == 0.0)
+         {
+             [textView.window display];
+             firstPaintTime = CFAbsoluteTimeGetCurrent() - startTime;
+         }
+         else
+         {
+             longestChunkTime = MAX(longestChunkTime, now - chunkStartTime);
+         }
+         
+         chunkStartTime = CFAbsoluteTimeGetCurrent();
+         
+         return YES;
+     }
+                completionHandler:^(BOOL finished, NSTimeInterval firstScreenfulTime)
+     {
+         totalTime = CFAbsoluteTimeGetCurrent() - startTime;
+         loaded = finished;
+         done = YES;
+     }];
+    
+    while (!done)
+        [[NSRunLoop mainRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate distantFuture]];
+    
+    BOOL matches = [textView.string isEqualToString:expectedString];
+    
+    [textView.window close];
+    
+    printf("%s (%.1f MB of RTF, %lu characters):\n", name.UTF8String, rtf.length / 1048576.0, (unsigned long)expectedString.length);
+    printf("  Synchronous first paint: %8.3f s\n", syncTime);
+    printf("  Chunked first paint:     %8.3f s (%.1fx sooner)\n", firstPaintTime, syncTime / MAX(firstPaintTime, 1e-9));
+    printf("  Chunked full load:       %8.3f s, longest chunk %.3f s\n", totalTime, longestChunkTime);
+    
+    if (!loaded || !matches)
+    {
+        fprintf(stderr, "  The chunked load %s\n", loaded ? "produced different text" : "didn't finish");
+        return NO;
+    }
+    
+    return YES;
+}
+
+int main(int argc, const char *argv[])
+{
+    @autoreleasepool
+    {
+        [NSApplication sharedApplication];
+        
+        NSUInteger megabytes = argc > 1 ? (NSUInteger)MAX(atoi(argv[1]), 1) : 20;
+        NSUInteger length = megabytes * 1024 * 1024 / 2;
+        BOOL success = DejalBenchmarkLoad(@"Many paragraphs", DejalBenchmarkRTF(length, YES));
+        
+        success = DejalBenchmarkLoad(@"One paragraph", DejalBenchmarkRTF(length, NO)) && success;
+        
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+}
+